@@ -0,0 +1,113 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  //
+  // kinds of anomalies
+  //
+  enum class AnomalyType : uint8_t
+  {
+    NONE,          //! nothing found
+    NIGHT_DECAY,   //! pressure falls in the night without pump and without draw (value mbar/h)
+    PUMP_CYCLING,  //! more pump starts in an hour than allowed (value starts)
+    DECAY_SHIFT    //! quiet decay rate rose and stays (CUSUM, value mbar/min above the normal)
+  };
+
+  //
+  // one event, kept in a ring for the api
+  //
+  struct anomaly_event_t
+  {
+    uint32_t timestamp;  //! UTC secounds
+    int32_t value;       //! see AnomalyType
+    AnomalyType type;    //! what
+  };
+
+  //
+  // limits for the detector (from appPrefs on the device)
+  //
+  struct anomaly_params_t
+  {
+    int32_t pumpEdgeMbar;     //! rise from one sample to the next: pump runs (first: start)
+    int32_t drawMbarMin;      //! faster fall: water is drawn, not a leak
+    uint32_t maxGapS;         //! more time between samples: start new
+    uint32_t nightMinS;       //! min length of a quiet night segment
+    int32_t nightDecayMbarH;  //! segment falls faster: NIGHT_DECAY
+    uint32_t maxStartsHour;   //! more pump starts in one hour: PUMP_CYCLING
+    uint32_t cusumWindow;     //! quiet samples for one decay rate
+    int32_t cusumKQ4;         //! CUSUM allowance, mbar/min Q4
+    int32_t cusumHQ4;         //! CUSUM limit, mbar/min Q4 (sum over windows)
+    uint8_t baselineShift;    //! normal decay rate: EWMA 1 / 2^shift
+  };
+
+  //
+  // streaming detector for the pressure samples, O(1) memory and time per sample
+  // - night decay: least squares slope of quiet segments (no pump start, no draw) in the night
+  // - pump cycling: rising edges counted per clock hour
+  // - decay shift: one sided CUSUM of the quiet decay rate (over a window of samples,
+  //   the noise of single samples cancels out) against its slow average
+  // integer only, no Arduino dependency
+  //
+  class AnomalyDetector
+  {
+    private:
+    anomaly_params_t params;  //! limits
+    bool hasLast;             //! lastSec / lastMbar valid
+    uint32_t lastSec;         //! time of the sample before
+    int32_t lastMbar;         //! pressure of the sample before
+    bool pumpRising;          //! last sample was a pump edge
+    uint32_t hour;            //! current clock hour (secounds / 3600)
+    uint32_t startsThisHour;  //! pump starts in the current hour
+    uint32_t startsLastHour;  //! pump starts in the hour before
+    uint32_t pumpStarts;      //! pump starts since start
+    uint32_t segStart;        //! first sample of the night segment
+    uint32_t segLast;         //! last sample of the night segment
+    int64_t segN;             //! least squares sums of the night segment
+    int64_t segSt;            //! (t relative to the segment start)
+    int64_t segSp;
+    int64_t segStt;
+    int64_t segStp;
+    int32_t nightSlope;       //! slope of the last night segment, mbar/h
+    uint32_t windowCount;     //! quiet samples in the decay window
+    int32_t windowDrop;       //! fall of the pressure in the window, mbar
+    uint32_t windowSec;       //! length of the window
+    int32_t baselineQ4;       //! normal quiet decay rate, mbar/min Q4
+    int32_t cusumQ4;          //! CUSUM sum
+    bool baselineValid;       //! baseline has a first value
+
+    public:
+    explicit AnomalyDetector( const anomaly_params_t & );
+    AnomalyType update( uint32_t, int32_t, bool, int32_t & );  //! sample (UTC s, mbar, night?), event and value
+    uint32_t getStartsThisHour() const                         //! pump starts in the current hour
+    {
+      return startsThisHour;
+    }
+    uint32_t getStartsLastHour() const                         //! pump starts in the hour before
+    {
+      return startsLastHour;
+    }
+    uint32_t getPumpStarts() const                             //! pump starts since start
+    {
+      return pumpStarts;
+    }
+    int32_t getNightSlope() const                              //! last night segment, mbar/h
+    {
+      return nightSlope;
+    }
+    int32_t getBaselineQ4() const                              //! normal quiet decay, mbar/min Q4
+    {
+      return baselineQ4;
+    }
+    int32_t getCusumQ4() const                                 //! CUSUM sum, mbar/min Q4
+    {
+      return cusumQ4;
+    }
+    static const char *getName( AnomalyType );                 //! short name (api, log)
+
+    private:
+    void segmentAdd( uint32_t, int32_t );  //! sample into the night segment
+    bool segmentEnd( int32_t & );          //! close the segment, true if it falls too fast
+  };
+}  // namespace measure_h2o
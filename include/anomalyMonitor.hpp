@@ -0,0 +1,40 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "appPrefs.hpp"
+#include "anomalyDetector.hpp"
+
+namespace measure_h2o
+{
+  //
+  // runs the anomaly detector on every measure with valid time (measure task)
+  // keeps a ring of the last events for the api, an event is shown on LCD and LED
+  // until it is acknowledged or ANOMALY_SHOW_YS is over
+  //
+  class AnomalyMonitor
+  {
+    private:
+    static const char *tag;                                   //! name of the module for debug
+    static portMUX_TYPE ringMux;                              //! protect the ring (measure task vs. http)
+    static AnomalyDetector detector;                          //! the streaming detector
+    static anomaly_event_t ring[ prefs::ANOMALY_RING_SIZE ];  //! last events
+    static uint32_t eventCount;                               //! events since start
+    static volatile AnomalyType activeType;                   //! event to show, NONE if acknowledged
+    static volatile int64_t activeSince;                      //! uptime of the shown event
+
+    public:
+    static void process( uint32_t, int32_t );           //! measure (UTC secounds, mbar)
+    static AnomalyType getActive();                     //! event to show, NONE if none
+    static void acknowledge();                          //! stop showing the event
+    static bool getEvent( size_t, anomaly_event_t & );  //! copy of an event, age 0 is the newest
+    static size_t getEventCount();                      //! events in the ring
+    static uint32_t getEventsTotal()                    //! events since start
+    {
+      return AnomalyMonitor::eventCount;
+    }
+    static const AnomalyDetector &getDetector()         //! state of the detector
+    {
+      return AnomalyMonitor::detector;
+    }
+  };
+}  // namespace measure_h2o
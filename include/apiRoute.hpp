@@ -0,0 +1,55 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+class AsyncWebServerRequest;
+
+namespace measure_h2o
+{
+  //
+  // type of the required parameter of an api route
+  //
+  enum class ApiParam : uint8_t
+  {
+    NONE,   //! no parameter
+    TEXT,   //! any string
+    NUMBER  //! integer, maybe negative
+  };
+
+  //
+  // the parsed parameter for the handler
+  //
+  struct api_arg_t
+  {
+    const char *text;  //! value of the parameter, nullptr with NONE
+    int32_t number;    //! value with NUMBER
+  };
+
+  using api_handler_t = void ( * )( AsyncWebServerRequest *, const api_arg_t & );
+  using api_param_lookup_t = const char *( * )( void *, const char * );  //! value of a request parameter or nullptr
+
+  //
+  // one entry of the api route table (path after "/api/v1/")
+  // entrys with the same path are alternatives with different parameters
+  //
+  struct api_route_t
+  {
+    const char *path;       //! path after the api prefix
+    const char *param;      //! required parameter or nullptr
+    ApiParam type;          //! type of the parameter
+    api_handler_t handler;  //! function for the request
+  };
+
+  //
+  // route lookup and parameter parsing, linear scan (only a few entrys)
+  // no Arduino dependency, the request is behind the lookup function
+  //
+  class ApiDispatch
+  {
+    public:
+    //! route for path and parameters, nullptr if none (then the parameter the path wants or nullptr)
+    static const api_route_t *match( const api_route_t *, size_t, const char *, api_param_lookup_t, void *, api_arg_t &,
+                                     const char *& );
+    static bool parseArg( ApiParam, const char *, api_arg_t & );  //! check and convert a parameter value
+  };
+}  // namespace measure_h2o
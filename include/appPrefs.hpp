@@ -35,8 +35,32 @@ namespace prefs
   constexpr int64_t LED_CHECK_DIFF_TIME_MS = 200LL;                            //! time between task for led sleeps
   constexpr gpio_num_t PRESSURE_GPIO = GPIO_NUM_0;                             //! analog read pressure
   constexpr uint8_t PRESSURE_RES = 12;                                         //! resulution für current
-  constexpr double PRESSURE_CALIBR_VALUE = 2.08333;                            //! factor raw->millivolt
+  constexpr double PRESSURE_CALIBR_VALUE = 2.08333;                            //! factor bar per volt (old prefs)
+  constexpr uint32_t PRESSURE_CALIBR_Q16 = 136533;                             //! 2.08333 mbar per mV as Q16.16
+  constexpr int32_t PRESSURE_MAX_MBAR = 6000;                                  //! more is a sensor error
+  constexpr size_t CALIB_MAX_POINTS = 8;                                       //! points of the calibration curve
+  constexpr uint32_t CALIB_MIN_DIFF_MV = 20;                                   //! closer points replace each other
+  constexpr int32_t TEMP_REF_CENTI_C = 2500;                                   //! compensated to 25.00 °C
+  constexpr uint32_t TEMP_STABLE_MV = 10;                                      //! max tension change for learning
+  constexpr int32_t TEMP_MIN_STEP_CENTI_C = 10;                                //! min temperature change for learning
+  constexpr int64_t TEMP_MIN_SUM_XX = 50000LL;                                 //! temperature variation before use
+  constexpr int64_t TEMP_MAX_SUM_XX = 5000000LL;                               //! more: forget the older half
+  constexpr int32_t TEMP_MAX_COEFF_Q16 = 1311;                                 //! max 2 mV per °C
+  constexpr uint32_t TEMP_SAVE_PAIRS = 120;                                    //! save the coefficient every n pairs
   constexpr uint32_t CURRENT_BORDER_FOR_CALIBR = 380;                          //! max value for calibr
+  constexpr uint32_t AUTOZERO_NEAR_MV = 25;                                    //! idle window mean this near the zero
+  constexpr uint32_t AUTOZERO_BAND_MV = 6;                                     //! idle window max - min
+  constexpr int32_t AUTOZERO_MAX_SHIFT_MV = 60;                                //! max tracked zero shift
+  constexpr int32_t AUTOZERO_MAX_STEP_Q4 = 8;                                  //! max 0.5 mV shift per window
+  constexpr uint8_t AUTOZERO_GAIN_SHIFT = 3;                                   //! step = 1/8 of the offset
+  constexpr uint32_t AUTOZERO_SAVE_UPDATES = 12;                               //! save the shift every n updates
+  constexpr uint32_t HEALTH_OPEN_MV = 150;                                     //! below: wire open (0 bar ~ 300 mV)
+  constexpr uint32_t HEALTH_SHORT_MV = 3000;                                   //! above: short to supply (5 bar ~ 2700 mV)
+  constexpr uint32_t HEALTH_NOISE_MV = 30;                                     //! burst standard deviation above: noisy
+  constexpr uint32_t HEALTH_STUCK_COUNT = 20;                                  //! identical measures: stuck
+  constexpr uint32_t HEALTH_CONFIRM_COUNT = 2;                                 //! measures in a row for a new state
+  constexpr int64_t CALIBR_DEBOUNCE_YS = 20000LL;                              //! calibration key debounce
+  constexpr int64_t CALIBR_HOLDOFF_YS = 10000000LL;                            //! no new request after rejected
   constexpr uint32_t PRESSURE_MIN_MILIVOLT = 300;                              //! minimal milivolt 0 bar
   constexpr uint32_t PRESSURE_MAX_MILIVOLT = 2700;                             //! maximal milivolt 5 Bar
   constexpr uint32_t MEASURE_DIFF_TIME_S = 30;                                 //! diff between two measures secounds
@@ -50,13 +74,74 @@ namespace prefs
   constexpr const char *DATA_PATH{ "/data/" };                                 //! virtual path data
   constexpr const char *MOUNTPOINT{ "/spiffs" };                               //! mountpoint/makrker filesystem
   constexpr const char *WEB_PARTITION_LABEL{ "mydata" };                       //! label of the spiffs or null
-  constexpr int64_t FILE_TASK_DELAY_YS = 10LL * 1000000LL;                     //! delay time for saving task
+  constexpr int64_t FILE_TASK_DELAY_YS = 30LL * 1000000LL;                     //! delay time for saving task
   constexpr int64_t FILE_TASK_CHECK_DELAY_YS = 7LL * 6ULL * 60LL * 1000000LL;  //! delay time for check filesystem
   constexpr int64_t FILE_SYSTEM_SIZE_CHECK_YS = 59LL * 60LL * 1000000LL;       //! delay time for check filesystem ( one hour)
   constexpr size_t MIN_FILE_SYSTEM_FREE_SIZE = 300000;                         //! minimal free size on filesystem
   constexpr const char *DAYLY_FILE_NAME{ "%04d-%02d-%02d-pressure.csv" };      //! data dayly for pressure
-  constexpr const char *DAYLY_FILE_PATTERN{ "^/data/\\d\\d\\d\\d-\\d\\d-\\d\\d-pressure.csv$" };  //! filename pattern
-  constexpr time_t MAX_DATA_FILE_AGE_SEC = 5L * 24L * 60L * 60L;                                  //! max age for files
+  constexpr const char *DAYLY_FILE_SUFFIX{ "-pressure.csv" };                  //! end of the day file names
+  constexpr time_t MAX_DATA_FILE_AGE_SEC = 5L * 24L * 60L * 60L;               //! max age for files
+  constexpr uint32_t HTTP_MAX_IN_FLIGHT = 3;                                   //! max parallel file responses
+  constexpr uint32_t HTTP_MIN_FREE_BLOCK = 12288;                              //! min heap block for a file response
+  constexpr int HTTP_RETRY_AFTER_S = 2;                                        //! Retry-After if busy
+  constexpr size_t SINCE_MAX_BYTES = 8192;                                     //! max answer size for since requests
+  constexpr size_t RTC_JOURNAL_SIZE = 96;                                      //! unsaved measures in RTC memory
+  constexpr size_t OFFLINE_MAX_RECORDS = 240;                                  //! measures while time not synced
+  constexpr int64_t TIME_MIN_DRIFT_SPAN_YS = 10LL * 60LL * 1000000LL;          //! min time between syncs for drift
+  constexpr float TIME_MAX_DRIFT_PPM = 500.0F;                                 //! more is a time jump, not drift
+  constexpr float TIME_DRIFT_ALPHA = 0.3F;                                     //! filter for the drift estimate
+  constexpr size_t ARENA_BLOCKS = 6;                                           //! response blocks (parallel requests)
+  constexpr size_t ARENA_BLOCK_SIZE = 3072;                                    //! max size of a built response
+  constexpr int64_t UPLOAD_TASK_DELAY_YS = 60LL * 1000000LL;                   //! time between two uploads
+  constexpr int64_t UPLOAD_BACKOFF_MAX_YS = 30LL * 60LL * 1000000LL;           //! max delay after failed uploads
+  constexpr int32_t UPLOAD_HTTP_TIMEOUT_MS = 5000;                             //! timeout for collector requests
+  constexpr size_t UPLOAD_MAX_BATCH = 64;                                      //! max records per POST
+  constexpr size_t UPLOAD_MAX_QUEUE = 256;                                     //! max records in RAM, then spool
+  constexpr size_t UPLOAD_MAX_SPOOL_SIZE = 96000;                              //! max size of the spool file
+  constexpr const char *UPLOAD_SPOOL_FILE{ "/data/upload-spool.lp" };          //! spool while collector offline
+  constexpr const char *UPLOAD_MEASUREMENT{ "water_pressure" };                //! influx measurement name
+  constexpr const char *API_V1_PATH{ "/api/v1" };                              //! prefix of the api version 1
+  constexpr size_t WWW_TMPL_VALUE_LEN = 32;                                    //! max length of a template value
+  constexpr const char *LIVE_PATH{ "/api/v1/live" };                           //! url for the SSE live stream
+  constexpr size_t LIVE_RING_SIZE = 32;                                        //! samples in the fan-out buffer
+  constexpr size_t LIVE_MAX_CLIENTS = 4;                                       //! max subscribers live stream
+  constexpr size_t LIVE_MAX_PACKETS_WAITING = 8;                               //! queued msgs of a client, than skip
+  constexpr uint32_t LIVE_MIN_FREE_BLOCK = 16384;                              //! min heap block for sending
+  constexpr float LIVE_FILTER_ALPHA = 0.25F;                                   //! low pass for filtered value
+  constexpr const char *WS_PATH{ "/ws" };                                      //! url for the websocket channel
+  constexpr size_t WS_MAX_CLIENTS = 2;                                         //! max websocket clients
+  constexpr size_t WS_MAX_QUEUED = 8;                                          //! max queued frames per client
+  constexpr size_t WS_HISTORY_CHUNK = 64;                                      //! records per history frame
+  constexpr size_t WS_HISTORY_DAYS = 2;                                        //! day files per history round
+  constexpr int64_t HEAP_SAMPLE_YS = 30LL * 1000000LL;                         //! time between two heap samples
+  constexpr size_t HEAP_RING_SIZE = 60;                                        //! heap samples in history
+  constexpr uint32_t HEAP_SHED_BLOCK = 16384;                                  //! largest block below, shed http load
+  constexpr uint32_t HEAP_FLUSH_BLOCK = 10240;                                 //! largest block below, also flush queues
+  constexpr uint32_t HEAP_HYSTERESIS = 2048;                                   //! back to normal above level + this
+  constexpr int32_t PUMP_START_MBAR = 150;                                     //! rise between two measures: pump on
+  constexpr int32_t PUMP_STOP_MBAR = 30;                                       //! less rise: pump off (peak)
+  constexpr uint32_t PUMP_MAX_GAP_S = 600;                                     //! longer without measure: cycle lost
+  constexpr uint32_t PUMP_SHORT_ON_S = 60;                                     //! on time below: short cycle
+  constexpr uint32_t PUMP_SHORT_DISTANCE_S = 300;                              //! off time below: short cycle
+  constexpr size_t PUMP_LOG_MAX_RECORDS = 2048;                                //! cycle log size, then to .old
+  constexpr size_t PUMP_API_RECORDS = 20;                                      //! newest cycles in the api (one block)
+  constexpr const char *PUMP_LOG_FILE{ "/data/pump-cycles.bin" };              //! cycle log (pump_cycle_t)
+  constexpr const char *PUMP_LOG_OLD_FILE{ "/data/pump-cycles.old" };          //! cycle log before
+  constexpr int32_t ANOMALY_DRAW_MBAR_MIN = 50;                                //! faster fall: water drawn
+  constexpr uint32_t ANOMALY_MAX_GAP_S = 600;                                  //! longer without measure: start new
+  constexpr int ANOMALY_NIGHT_FROM_H = 1;                                      //! quiet night from (local hour)
+  constexpr int ANOMALY_NIGHT_TO_H = 5;                                        //! quiet night until (local hour)
+  constexpr uint32_t ANOMALY_NIGHT_MIN_S = 1800;                               //! min quiet night segment
+  constexpr int32_t ANOMALY_NIGHT_DECAY_MBAR_H = 100;                          //! faster fall in the night: leak
+  constexpr uint32_t ANOMALY_MAX_STARTS_HOUR = 12;                             //! more pump starts: cycling
+  constexpr uint32_t ANOMALY_CUSUM_WINDOW = 10;                                //! quiet measures for one decay rate
+  constexpr int32_t ANOMALY_CUSUM_K_Q4 = 48;                                   //! allowance 3 mbar/min
+  constexpr int32_t ANOMALY_CUSUM_H_Q4 = 640;                                  //! limit 40 mbar/min (sum)
+  constexpr uint8_t ANOMALY_BASELINE_SHIFT = 4;                                //! normal decay learns 1/16 per window
+  constexpr size_t ANOMALY_RING_SIZE = 16;                                     //! events for the api
+  constexpr int64_t ANOMALY_SHOW_YS = 6LL * 3600LL * 1000000LL;                //! LCD / LED show an event this long
+  constexpr size_t STATS_WINDOW_COUNT = 4;                                     //! rolling statistics windows
+  constexpr uint32_t STATS_WINDOW_S[ STATS_WINDOW_COUNT ]{ 60, 900, 3600, 86400 };  //! 1 min, 15 min, 1 h, 24 h
 
   //
   // LED COLORS
@@ -73,5 +158,7 @@ namespace prefs
   constexpr uint32_t LED_COLOR_MEASURE_ACTICE = 0x00f00cd1;
   constexpr uint32_t LED_COLOR_MEASURE_INACTICE = 0x00bd660f;
   constexpr uint32_t LED_COLOR_HTTP_ACCESS = 0x00FFFFA0;
+  constexpr uint32_t LED_COLOR_SENSOR_FAULT = 0x00FF0000;
+  constexpr uint32_t LED_COLOR_ANOMALY = 0x00FF8000;
 
 }  // namespace prefs
\ No newline at end of file
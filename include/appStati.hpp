@@ -16,9 +16,10 @@ namespace prefs
     static Preferences lPref;                //! static preferences object
     static uint32_t calibreMinVal;           //! minimal value by calibr
     static uint32_t calibreMaxVal;           //! maximal value by calibr
-    static double calibreFactor;             //! computed linear factor
+    static uint32_t calibreFactorQ16;        //! computed linear factor, mbar per mV as Q16.16
     static uint32_t currentMiliVolts;        //! current measured value
-    static float currentPressureBar;         //! current measured value
+    static int32_t currentPressureMbar;      //! current measured value
+    static int16_t currentTemperature;       //! chip temperature 0.01 °C
     static volatile bool presureWasChanged;  //! was presure changed?
     static WlanState wlanState;              //! is wlan disconnected, connected etc....
     static size_t fsTotalSpace;              //! total space in FS
@@ -36,24 +37,40 @@ namespace prefs
     {
       return Filesystem::getIsOkay();
     }
-    static uint32_t getCalibreMinVal();    //! get minimal value
-    static uint32_t getCalibreMaxVal();    //! get the minimal value for sensor meaning "no pressure" or "pressure == 0"
-    static double getCalibreFactor();      //! factor for comuting the "real" pressure
+    static uint32_t getCalibreMinVal();     //! get minimal value
+    static uint32_t getCalibreMaxVal();     //! get the minimal value for sensor meaning "no pressure" or "pressure == 0"
+    static uint32_t getCalibreFactorQ16();  //! factor for comuting the "real" pressure (mbar per mV, Q16.16)
+    static float getCalibreFactor()         //! factor as float, only for show
+    {
+      return static_cast< float >( AppStati::getCalibreFactorQ16() ) / 65536.0F;
+    }
     static uint32_t getCurrentMiliVolts()  //! current measured tension from AD Chip
     {
       return AppStati::currentMiliVolts;
     }
-    static float getCurrentPressureBar()  //! get the current measured pressure from sensor
+    static int32_t getCurrentPressureMbar()  //! get the current measured pressure from sensor
+    {
+      return AppStati::currentPressureMbar;
+    }
+    static float getCurrentPressureBar()  //! current pressure as float, for show and records
+    {
+      return static_cast< float >( AppStati::currentPressureMbar ) / 1000.0F;
+    }
+    static int16_t getCurrentTemperature()  //! chip temperature at the last measure, 0.01 °C
+    {
+      return AppStati::currentTemperature;
+    }
+    static void setCurrentTemperature( int16_t _val )  //! set the chip temperature
     {
-      return AppStati::currentPressureBar;
+      AppStati::currentTemperature = _val;
     }
     //
-    static void setCalibreMinVal( uint32_t );     //! set the value for pressure == 0
-    static void setCalibreMaxVal( uint32_t );     //! set the value for pressure == max
-    static void setCalibreFactor( double );       //! set the factor for computing the "real" preasure
-    static void setCurrentMiliVolts( uint32_t );  //! set the current tension
-    static void setCurrentPressureBar( float );   //! set the current pressure
-    static bool getWasChanged()                   //! was the pressure changed since last measure
+    static void setCalibreMinVal( uint32_t );       //! set the value for pressure == 0
+    static void setCalibreMaxVal( uint32_t );       //! set the value for pressure == max
+    static void setCalibreFactorQ16( uint32_t );    //! set the factor for computing the "real" preasure
+    static void setCurrentMiliVolts( uint32_t );    //! set the current tension
+    static void setCurrentPressureMbar( int32_t );  //! set the current pressure
+    static bool getWasChanged()                     //! was the pressure changed since last measure
     {
       return AppStati::presureWasChanged;
     }
@@ -89,17 +106,27 @@ namespace prefs
     {
       return ( AppStati::fsTotalSpace - AppStati::fsUsedSpace );
     }
-    static String getTimeZone();                      //! get my timezone
-    static bool setTimeZone( const String & );        //! set my timezone
-    static bool setTimezoneOffset( long );            //! set timezione offst instread of timezone
-    static long getTimezoneOffset();                  //! get the offset for timezone
-    static uint8_t getLogLevel();                     //! get Logging
-    static bool setLogLevel( uint8_t );               //! set Logging
-    static uint32_t getMeasureInterval_s();           //! get interval bwtween two measures
-    static bool setMeasureInterval_s( uint32_t );     //! set Interval bewtween two measures
-    static uint8_t getLedBrightness();                //! get led ground brightness
-    static bool setLedBrightness( uint8_t );          //! set led ground brightness
-    static void setForceFilesystemCheck( bool _set )  //! set / unset force an filesystem check
+    static String getTimeZone();                                  //! get my timezone
+    static bool setTimeZone( const String & );                    //! set my timezone
+    static bool setTimezoneOffset( long );                        //! set timezione offst instread of timezone
+    static long getTimezoneOffset();                              //! get the offset for timezone
+    static uint8_t getLogLevel();                                 //! get Logging
+    static bool setLogLevel( uint8_t );                           //! set Logging
+    static uint32_t getMeasureInterval_s();                       //! get interval bwtween two measures
+    static bool setMeasureInterval_s( uint32_t );                 //! set Interval bewtween two measures
+    static uint8_t getLedBrightness();                            //! get led ground brightness
+    static bool setLedBrightness( uint8_t );                      //! set led ground brightness
+    static String getUploadUrl();                                 //! get collector url for push uploads
+    static bool setUploadUrl( const String & );                   //! set collector url (empty == off)
+    static size_t getCalibPoints( calib_point_t * );              //! calibration curve, max CALIB_MAX_POINTS
+    static int32_t getTempCoefficient();                          //! temperature coefficient (mV per 0.01 °C, Q16.16)
+    static bool setTempCoefficient( int32_t );                    //! save learned temperature coefficient
+    static int32_t getZeroShiftQ4();                              //! tracked zero shift (1/16 mV)
+    static bool setZeroShiftQ4( int32_t );                        //! save tracked zero shift
+    static bool getAutoZero();                                    //! zero tracking on?
+    static bool setAutoZero( bool );                              //! switch zero tracking
+    static bool setCalibPoints( const calib_point_t *, size_t );  //! save calibration curve (0 points == remove)
+    static void setForceFilesystemCheck( bool _set )              //! set / unset force an filesystem check
     {
       AppStati::forceFilesystemCheck = _set;
     }
@@ -3,6 +3,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <stdint.h>
+#include "calibCurve.hpp"
 
 namespace measure_h2o
 {
@@ -22,17 +23,166 @@ namespace measure_h2o
 
   //
   // struct for transport measured data
+  // plain 16 byte record (little endian), this layout
+  // is also sent via websocket, change RECORD_VERSION if changed
   //
   struct presure_data_t
   {
-    String timestamp;    //! timestamp
-    uint32_t miliVolts;  //! current measured value
-    float pressureBar;   //! current measured value
+    uint32_t timestamp;   //! timestamp UTC secounds since epoch
+    float pressureBar;    //! current measured value
+    uint32_t miliVolts;   //! current measured value (temperature compensated)
+    int16_t temperature;  //! chip temperature 0.01 °C, -32768 if unknown
+    uint16_t reserved;    //! 0
   };
+  static_assert( sizeof( presure_data_t ) == 16, "record layout changed, check websocket clients!" );
+  constexpr uint8_t RECORD_VERSION = 2;
 
   // name for datasets for save mesures
   using presure_data_set_t = std::vector< presure_data_t >;
 
+  //
+  // time of an event from TimeKeeper, both clocks from one read
+  //
+  struct time_stamp_t
+  {
+    int64_t monoYs;  //! esp_timer microsecounds since start
+    int64_t wallYs;  //! UTC microsecounds since epoch, 0 if the time was never synced
+  };
+
+  //
+  // measure while the time is not synced, stamped with the monotonic clock
+  //
+  struct offline_record_t
+  {
+    int64_t monoYs;       //! esp_timer microsecounds at the measure
+    float pressureBar;    //! measured value
+    uint32_t miliVolts;   //! measured value
+    int16_t temperature;  //! chip temperature 0.01 °C
+  };
+
+  //
+  // struct for one sample in the live stream
+  //
+  struct live_sample_t
+  {
+    uint32_t seq;         //! sequence number (event id)
+    uint32_t epoch;       //! timestamp UTC secounds
+    uint32_t miliVolts;   //! measured tension
+    float pressureBar;    //! measured pressure
+    float filteredBar;    //! low pass filtered pressure
+    int16_t temperature;  //! chip temperature 0.01 °C
+  };
+
+  //
+  // header of a binary websocket frame, followed by <count> records
+  //
+  enum WsFrameType : uint8_t
+  {
+    WS_FRAME_HISTORY = 1,
+    WS_FRAME_HISTORY_END = 2,
+    WS_FRAME_LIVE = 3
+  };
+
+  struct ws_frame_header_t
+  {
+    uint8_t type;     //! WsFrameType
+    uint8_t version;  //! RECORD_VERSION
+    uint16_t count;   //! count of records in frame
+  };
+  static_assert( sizeof( ws_frame_header_t ) == 4, "websocket frame header layout changed!" );
+
+  //
+  // state of a websocket client
+  //
+  struct ws_client_state_t
+  {
+    uint32_t clientId;  //! id of the client, 0 == slot free
+    bool live;          //! send live samples
+    bool history;       //! history request running
+    uint32_t from;      //! history from (UTC secounds)
+    uint32_t to;        //! history to (UTC secounds)
+    time_t day;         //! history, current day file (local midnight)
+    size_t filePos;     //! history, read position in day file
+  };
+
+  //
+  // heap state, HeapMonitor
+  //
+  enum class HeapLevel : uint8_t
+  {
+    NORMAL,  //! enough memory
+    SHED,    //! low, reject new file/text responses
+    FLUSH    //! very low, also move queues out of RAM
+  };
+
+  //
+  // one sample of the heap monitor
+  //
+  struct heap_sample_t
+  {
+    uint32_t uptime;    //! secounds since start
+    uint32_t free;      //! free heap
+    uint32_t minFree;   //! min free heap since start
+    uint32_t maxBlock;  //! largest free block
+    uint8_t fragPct;    //! fragmentation 100 - maxBlock * 100 / free
+    HeapLevel level;    //! level after this sample
+  };
+
+  //
+  // zero calibration by key, done in the measure task
+  //
+  enum class ZeroCalib : uint8_t
+  {
+    NONE,     //! nothing requested
+    PENDING,  //! requested, measure task not ready
+    DONE,     //! new zero point set
+    REJECTED  //! pressure on the sensor, not set
+  };
+
+  //
+  // web file compiled into the firmware, table made by tools/makeWww.py
+  //
+  struct www_asset_t
+  {
+    const char *path;       //! virtual path on the controller
+    const char *etag;       //! content hash of the uncompressed file
+    const uint8_t *data;    //! plain content (flash)
+    size_t size;            //! size of plain content
+    const uint8_t *gzData;  //! gzip content (flash)
+    size_t gzSize;          //! size of gzip content
+  };
+
+  //
+  // placeholders in the html templates (%NAME%)
+  //
+  enum class TmplVar : uint8_t
+  {
+    NONE,  //! literal segment
+    APP_VERSION,
+    IDF_VERSION,
+    ESP_MODEL,
+    ESP_CORES,
+    MEASURE_INTERVAL,
+    COUNT  //! count of placeholders
+  };
+
+  //
+  // a template is a list of literal and placeholder segments
+  //
+  struct www_segment_t
+  {
+    const char *text;  //! literal text (flash) or nullptr
+    size_t len;        //! length of the literal text
+    TmplVar var;       //! placeholder, if no literal
+  };
+
+  struct www_template_t
+  {
+    const char *path;               //! virtual path on the controller
+    const www_segment_t *segments;  //! segments of the template
+    size_t count;                   //! count of segments
+  };
+
 }  // namespace measure_h2o
 
 // maybe:
@@ -0,0 +1,58 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  //
+  // limits for the zero tracking (from appPrefs on the device)
+  //
+  struct auto_zero_params_t
+  {
+    uint32_t nearMv;     //! max distance of the window mean from the (shifted) zero point
+    uint32_t bandMv;     //! max - min of the window, more is not idle
+    int32_t maxShiftMv;  //! limit for the shift (both signs)
+    int32_t maxStepQ4;   //! max change of the shift per update, 1/16 mV
+    uint8_t gainShift;   //! update = error >> gainShift
+  };
+
+  //
+  // tracks the drift of the zero point without the calibration key
+  // a window of measures near the zero point that is flat (pump off, line drained)
+  // moves the shift a small step towards the window mean; the shift is limited,
+  // so a line with a small standing pressure can't pull the zero point far
+  // integer only, no Arduino dependency
+  //
+  class AutoZero
+  {
+    public:
+    static constexpr size_t WINDOW = 10;  //! measures for one decision
+
+    private:
+    auto_zero_params_t params;  //! limits
+    uint16_t window[ WINDOW ];  //! last measures (compensated millivolts)
+    size_t count;               //! measures in the window
+    int32_t shiftQ4;            //! zero shift, 1/16 mV
+    uint32_t updates;           //! count of shift updates
+    bool idle;                  //! last full window was idle
+
+    public:
+    explicit AutoZero( const auto_zero_params_t & );
+    void setShiftQ4( int32_t );                   //! shift (e.g. from NVS), limited
+    int32_t getShiftQ4() const                    //! zero shift, 1/16 mV
+    {
+      return shiftQ4;
+    }
+    uint32_t getUpdates() const                   //! count of shift updates
+    {
+      return updates;
+    }
+    bool isIdle() const                           //! last window was flat near zero
+    {
+      return idle;
+    }
+    void reset();                                 //! new zero point (calibration), shift 0
+    bool update( uint32_t, uint32_t );            //! measure and zero point, true if the shift changed
+    uint32_t apply( uint32_t ) const;             //! millivolts minus shift
+  };
+}  // namespace measure_h2o
@@ -0,0 +1,44 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  //
+  // one point of the calibration curve (blob in NVS, sorted by miliVolts)
+  //
+  struct calib_point_t
+  {
+    uint16_t miliVolts;  //! sensor tension
+    int16_t mbar;        //! reference pressure
+  };
+  static_assert( sizeof( calib_point_t ) == 4, "calibration point layout changed!" );
+
+  //
+  // piecewise linear curve millivolts -> millibar from sorted points, outside extrapolated;
+  // the segments are precomputed (start, base, slope Q16.16), the segment is found
+  // with a fixed count of steps without branches
+  // integer only, no Arduino dependency
+  //
+  class CalibCurve
+  {
+    public:
+    static constexpr size_t MAX_POINTS = 8;  //! the segment search makes three steps (4, 2, 1)
+
+    private:
+    int32_t knotMv[ MAX_POINTS ];    //! start of segment, INT32_MAX if unused
+    int32_t baseMbar[ MAX_POINTS ];  //! pressure at the start of segment
+    int32_t slopeQ16[ MAX_POINTS ];  //! mbar per mV in the segment, Q16.16
+    size_t pointCount;               //! points of the curve
+
+    public:
+    CalibCurve();
+    void build( const calib_point_t *, size_t );  //! segments from the sorted points
+    bool isCurve() const                          //! two points or more
+    {
+      return pointCount >= 2;
+    }
+    int32_t toMbar( int32_t ) const;              //! millivolts to millibar (only with isCurve)
+    int32_t getZeroMv() const;                    //! millivolts at 0 mbar, -1 if not known
+  };
+}  // namespace measure_h2o
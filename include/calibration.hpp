@@ -0,0 +1,36 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+#include "calibCurve.hpp"
+
+namespace measure_h2o
+{
+  //
+  // calibration curve millivolts -> millibar
+  // with less than two points linear (zero point + factor, as before),
+  // else piecewise linear between the points (sorted, in NVS), see CalibCurve
+  //
+  class Calibration
+  {
+    private:
+    static const char *tag;                                  //! name of the module for debug
+    static portMUX_TYPE calMux;                              //! protect the segments (measure task vs. api)
+    static calib_point_t points[ prefs::CALIB_MAX_POINTS ];  //! the curve, as in NVS
+    static size_t pointCount;                                //! used points
+    static CalibCurve curve;                                 //! segments of the points
+
+    public:
+    static void init();                          //! curve from NVS
+    static int32_t toMbar( uint32_t );           //! millivolts to millibar
+    static uint32_t getZeroMv();                 //! millivolts at 0 mbar
+    static bool addPoint( uint32_t, int32_t );   //! add or replace a point, save
+    static void clear();                         //! remove the curve (linear again)
+    static size_t getPoints( calib_point_t * );  //! copy of the curve, returns count
+    static size_t getPointCount()                //! points in the curve
+    {
+      return Calibration::pointCount;
+    }
+  };
+}  // namespace measure_h2o
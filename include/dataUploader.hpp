@@ -0,0 +1,58 @@
+#pragma once
+#include <memory>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <SPIFFS.h>
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+
+namespace measure_h2o
+{
+  class DataUploader
+  {
+    private:
+    static const char *tag;             //! name of the module for debug
+    static bool wasInit;                //! was the object initialized?
+    static TaskHandle_t taskHandle;     //! only one times
+    static SemaphoreHandle_t queueSem;  //! access to the upload queue
+    static presure_data_set_t queue;    //! measures wait for upload
+    static volatile size_t queueCount;  //! size of the queue, set with queueSem taken
+    static int64_t backoff_ys;          //! current delay after failed upload
+    static uint32_t uploadedCount;      //! count of uploaded records
+    static uint32_t failedCount;        //! count of failed uploads
+    static uint32_t droppedCount;       //! count of records lost (spool full)
+    static volatile bool flushWanted;   //! move the queue into the spool file (low memory)
+
+    public:
+    static void init();                             //! init the static object
+    static void enqueue( const presure_data_t & );  //! add a measure for upload
+    static size_t getQueueSize();                   //! records waiting in RAM
+    static void requestFlush()                      //! move the queue into the spool file, low memory
+    {
+      DataUploader::flushWanted = true;
+    }
+    static uint32_t getUploadedCount()              //! records uploaded since start
+    {
+      return DataUploader::uploadedCount;
+    }
+    static uint32_t getFailedCount()  //! failed uploads since start
+    {
+      return DataUploader::failedCount;
+    }
+    static uint32_t getDroppedCount()  //! records dropped since start
+    {
+      return DataUploader::droppedCount;
+    }
+
+    private:
+    static void start();                                                 //! init the task
+    static void uTask( void * );                                         //! the static task in thes object
+    static bool uploadQueue( const String & );                           //! upload a batch from queue
+    static bool uploadSpool( const String & );                           //! upload the spool file
+    static bool spoolQueue( size_t );                                    //! move records from queue into spool file
+    static int post( const String &, uint8_t *, size_t );                //! http POST a buffer to collector
+    static int post( const String &, Stream *, size_t );                 //! http POST a stream to collector
+    static size_t formatLine( char *, size_t, const presure_data_t & );  //! make a line protocol line
+  };
+}  // namespace measure_h2o
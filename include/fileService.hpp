@@ -16,24 +16,31 @@ namespace measure_h2o
     static bool wasInit;             //! was the prefs object initialized?
     static TaskHandle_t taskHandle;  //! only one times
     static String todayFileName;     //! todays file name
-    static int todayDay;             //! todays day number
+    static int todayDay;             //! todays date (yyyymmdd)
 
     public:
     static SemaphoreHandle_t measureFileSem;  //! is access to files busy
     static presure_data_set_t dataset;        //! set of mesures
 
     public:
-    static void init();                 //! init the static object
-    static String &getTodayFileName();  //! get the filename for today
-    static bool deleteTodayFile();      //! delete the file from today
+    static void init();                                            //! init the static object
+    static String &getTodayFileName();                             //! get the filename for today
+    static String getDayFileName( time_t );                        //! get the filename for the day of a timestamp
+    static bool deleteTodayFile();                                 //! delete the file from today
+    static bool isDayFileName( const char * );                     //! match the name of a day file
+    static time_t getDayStart( time_t );                           //! local midnight of the day
+    static bool readSince( time_t &, size_t &, Print &, size_t );  //! records after day/offset, over days
+    static size_t saveDirect( presure_data_set_t & );              //! older set first, then records without journal
 
     private:
-    static void start();                       //! init the task
-    static void sTask( void * );               //! the static task in thes object
-    static int saveDatasets();                 //! save datasets from queue to file
-    static int removeOutdatedFiles();          //! check if the data have to care
-    static int removeOtherThanCurrentFiles();  //! emergency delete all other than current files
-    static int checkFileSysSizes();            //! check if enough free memory
-    static int computeAllFilesystemChecks();   //! do all the checks
+    static void start();                                            //! init the task
+    static void sTask( void * );                                    //! the static task in thes object
+    static int saveDatasets();                                      //! save datasets from queue to file
+    static size_t writeDataset();                                   //! the set into the files (caller holds the lock)
+    static size_t writeDayFiles( presure_data_set_t &, String & );  //! records into their day files
+    static int removeOutdatedFiles();                               //! check if the data have to care
+    static int removeOtherThanCurrentFiles();                       //! emergency delete all other than current files
+    static int checkFileSysSizes();                                 //! check if enough free memory
+    static int computeAllFilesystemChecks();                        //! do all the checks
   };
 }  // namespace measure_h2o
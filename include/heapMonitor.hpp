@@ -0,0 +1,55 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+
+namespace measure_h2o
+{
+  //
+  // samples the heap (free, min free, largest block, fragmentation)
+  // keeps a ring of the last samples and reacts before allocations fail:
+  // SHED: reject new http responses, FLUSH: also move the upload queue to flash
+  //
+  class HeapMonitor
+  {
+    private:
+    static const char *tag;                              //! name of the module for debug
+    static bool wasInit;                                 //! was the object initialized?
+    static TaskHandle_t taskHandle;                      //! only one times
+    static portMUX_TYPE ringMux;                         //! protect the ring (monitor task vs. http)
+    static heap_sample_t ring[ prefs::HEAP_RING_SIZE ];  //! last samples
+    static uint32_t sampleCount;                         //! samples since start
+    static volatile HeapLevel level;                     //! current level
+    static uint32_t shedCount;                           //! times switched to SHED or FLUSH
+    static uint32_t flushCount;                          //! times switched to FLUSH
+
+    public:
+    static void init();                                   //! init the static object
+    static bool shedLoad()                                //! reject new responses?
+    {
+      return HeapMonitor::level != HeapLevel::NORMAL;
+    }
+    static HeapLevel getLevel()                           //! current level
+    {
+      return HeapMonitor::level;
+    }
+    static uint32_t getShedCount()                        //! times switched to SHED or FLUSH
+    {
+      return HeapMonitor::shedCount;
+    }
+    static uint32_t getFlushCount()                       //! times switched to FLUSH
+    {
+      return HeapMonitor::flushCount;
+    }
+    static bool getSample( size_t, heap_sample_t & );     //! copy of a sample, age 0 is the newest
+    static size_t getSampleCount();                       //! samples in the ring
+    static const char *getLevelName( HeapLevel );         //! level as text
+
+    private:
+    static void start();                                  //! start monitor task
+    static void hTask( void * );                          //! the static task in thes object
+    static void sample();                                 //! take a sample, check the level
+    static HeapLevel nextLevel( HeapLevel, uint32_t );    //! level with hysteresis
+  };
+}  // namespace measure_h2o
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+namespace measure_h2o
+{
+  /**
+   * floor( sqrt( val ) ), bitwise, no FPU needed
+   */
+  inline uint32_t isqrt64( uint64_t _val )
+  {
+    uint64_t result{ 0 };
+    uint64_t bit = 1ULL << 62;
+    while ( bit > _val )
+      bit >>= 2;
+    while ( bit != 0 )
+    {
+      if ( _val >= result + bit )
+      {
+        _val -= result + bit;
+        result = ( result >> 1 ) + bit;
+      }
+      else
+      {
+        result >>= 1;
+      }
+      bit >>= 2;
+    }
+    return static_cast< uint32_t >( result );
+  }
+}  // namespace measure_h2o
@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+
+namespace measure_h2o
+{
+  //
+  // streaming json writer, writes direct into a Print (e.g. AsyncResponseStream)
+  // no tree, no heap, only the nesting state
+  //
+  class JsonWriter
+  {
+    private:
+    static constexpr uint8_t MAX_DEPTH = 16;  //! max nesting level
+    Print &out;                               //! destination
+    uint8_t depth;                            //! current nesting level
+    uint16_t hasElems;                        //! bit per level, level has elements (need comma)
+
+    public:
+    explicit JsonWriter( Print & );
+    void beginObject( const char *_key = nullptr );          //! start object (key only inside objects)
+    void endObject();                                        //! close object
+    void beginArray( const char *_key = nullptr );           //! start array (key only inside objects)
+    void endArray();                                         //! close array
+    void add( const char *, const char * );                  //! string value
+    void add( const char *, bool );                          //! boolean value
+    void add( const char *, int32_t );                       //! signed number
+    void add( const char *, uint32_t );                      //! unsigned number
+    void add( const char *, float, uint8_t _decimals = 2 );  //! float number, NaN as null
+
+    private:
+    void next( const char * );         //! comma and key for the next element
+    void writeString( const char * );  //! quoted and escaped string
+    void open( char, const char * );   //! open object or array
+    void close( char );                //! close object or array
+  };
+}  // namespace measure_h2o
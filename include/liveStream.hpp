@@ -0,0 +1,59 @@
+#pragma once
+#include <memory>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "ESPAsyncWebServer.h"
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+
+namespace measure_h2o
+{
+  class LiveStream
+  {
+    private:
+    static const char *tag;                                                //! name of the module for debug
+    static bool wasInit;                                                   //! was the object initialized?
+    static TaskHandle_t taskHandle;                                        //! only one times
+    static portMUX_TYPE ringMux;                                           //! protect the ring (measure task vs. sender)
+    static live_sample_t ring[ prefs::LIVE_RING_SIZE ];                    //! fan-out buffer of the last samples
+    static volatile uint32_t writeSeq;                                     //! sequence number of the next sample
+    static uint32_t sentSeq;                                               //! sequence number of the next sample to send
+    static float filteredBar;                                              //! low pass filter state
+    static SemaphoreHandle_t sourceSem;                                    //! access to event source/websocket (server reset)
+    static AsyncEventSource *events;                                       //! SSE handler, owned by the webserver
+    static AsyncEventSourceClient *sseClients[ prefs::LIVE_MAX_CLIENTS ];  //! SSE subscribers, owned by the handler
+    static AsyncWebSocket *ws;                                             //! websocket handler, owned by the webserver
+    static portMUX_TYPE slotMux;                                           //! protect the client tables (SSE, websocket)
+    static ws_client_state_t wsClients[ prefs::WS_MAX_CLIENTS ];           //! state of the websocket clients
+    static uint32_t skippedCount;                                          //! samples not sent while backpressure
+
+    public:
+    static void init();                             //! init the static object
+    static void publish( const presure_data_t & );  //! new sample from measure task
+    static void attach( AsyncWebServer & );         //! add SSE/websocket handler to webserver
+    static void detach();                           //! forget handlers before server.reset()
+    static size_t getClientCount();                 //! count of SSE subscribers
+    static size_t getWsClientCount();               //! count of websocket clients
+    static uint32_t getSkippedCount()               //! samples not sent, clients too slow
+    {
+      return LiveStream::skippedCount;
+    }
+
+    private:
+    static void start();                                                         //! start sender task
+    static void eTask( void * );                                                 //! the static task in thes object
+    static void onConnect( AsyncEventSourceClient * );                           //! new SSE subscriber
+    static void onSseDisconnect( void *, AsyncClient * );                        //! SSE subscriber gone
+    static void onWsEvent( AsyncWebSocket *, AsyncWebSocketClient *, AwsEventType, void *, uint8_t *,
+                           size_t );                                             //! websocket events
+    static void onWsCommand( AsyncWebSocketClient *, const char * );             //! text command from client
+    static void sendEvent( const live_sample_t & );                              //! sample to SSE subscribers
+    static void sendWsLive( const live_sample_t & );                             //! sample to websocket clients
+    static void sendWsHistory();                                                 //! next history chunks
+    static bool readHistoryChunk( ws_client_state_t &, uint8_t *, uint16_t & );  //! read records from day files
+    static bool parseDataLine( const char *, presure_data_t & );                 //! CSV line to record
+    static bool getSample( uint32_t, live_sample_t & );                          //! copy a sample from the ring
+    static size_t formatSample( char *, size_t, const live_sample_t & );         //! make json for a sample
+  };
+}  // namespace measure_h2o
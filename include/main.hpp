@@ -2,9 +2,7 @@
 
 void setup();
 void loop();
-time_t getNtpTime();
 
 void updateDisplay();
-void correctTime();
-int controlCalibr();
+void controlCalibr( int64_t );
 void checkOnlineState();
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+namespace measure_h2o
+{
+  //
+  // integer only number and time formatters, no printf, no heap, no float arithmetic
+  // except one multiply in fixed(); all write into the buffer, terminate with '\0'
+  // and return the length, 0 if the buffer is too small (buffer then is "")
+  // (no Arduino dependency, tools/bench-numformat.cpp builds it on the host)
+  //
+  class NumFormat
+  {
+    public:
+    static constexpr size_t ISO_LEN = 20;      //! buffer for "YYYY-MM-DDTHH:MM:SS"
+    static constexpr size_t NUM_LEN = 24;      //! buffer for every number
+    static constexpr uint8_t MAX_DECIMALS = 6;  //! max decimals of fixed() and scaled()
+
+    static size_t u32( char *, size_t, uint32_t, uint8_t _width = 0 );  //! unsigned, zero padded to width
+    static size_t i32( char *, size_t, int32_t );                        //! signed
+    static size_t scaled( char *, size_t, int64_t, uint8_t );            //! fixed point, value * 10^decimals
+    static size_t fixed( char *, size_t, float, uint8_t );               //! float rounded to decimals
+    static size_t isoDateTime( char *, size_t, const struct tm & );      //! broken down time (e.g. local)
+    static size_t isoDateTime( char *, size_t, time_t );                 //! epoch as UTC
+
+    private:
+    static size_t digits( char *, size_t, uint64_t, uint8_t );  //! decimal digits, zero padded
+    static char *put2( char *, uint32_t );                      //! two digits, returns the end
+  };
+}  // namespace measure_h2o
@@ -4,6 +4,10 @@
 #include <freertos/task.h>
 #include <esp32-hal-adc.h>
 #include "appPrefs.hpp"
+#include "appStructs.hpp"
+#include "tempComp.hpp"
+#include "autoZero.hpp"
+#include "sensorHealth.hpp"
 
 namespace measure_h2o
 {
@@ -11,21 +15,79 @@ namespace measure_h2o
   class PrSensor
   {
     private:
-    static const char *tag;                 //! Tag for debug and messages
-    static gpio_num_t adcPin;               //! gpio pin
-    static TaskHandle_t taskHandle;         //! only one times
-    static volatile bool pauseMeasureTask;  //! if i make an calibration, pause task
-    static int64_t interval_ys;             //! interval between two measures
+    static const char *tag;                                             //! Tag for debug and messages
+    static gpio_num_t adcPin;                                           //! gpio pin
+    static TaskHandle_t taskHandle;                                     //! only one times
+    static int64_t interval_ys;                                         //! interval between two measures
+    static offline_record_t offlineRing[ prefs::OFFLINE_MAX_RECORDS ];  //! measures before time sync
+    static uint32_t offlineWritten;                                     //! measures into the ring since last restamp
+    static uint32_t offlineRead;                                        //! measures of the ring saved (restamped)
+    static uint32_t offlineDropped;                                     //! measures lost, ring was full
+    static constexpr int32_t NO_CALIB_POINT = -1;                       //! no calibration point requested
+    static volatile int32_t calibPointMbar;                             //! requested calibration point (mbar)
+    static TempComp tempComp;                                           //! temperature compensation
+    static uint32_t tempLearnedSinceSave;                               //! coefficient updates since saved
+    static volatile ZeroCalib zeroCalib;                                //! zero calibration by key
+    static AutoZero autoZero;                                           //! zero tracking while idle
+    static volatile bool autoZeroOn;                                    //! zero tracking switched on
+    static uint32_t zeroUpdatesSinceSave;                               //! shift updates since saved
+    static SensorHealth health;                                         //! diagnostics of the sensor
+    static volatile SensorState healthState;                            //! copy of the state for other tasks
 
     public:
-    static void init();                 //! init the startic object
-    static bool calibreSensor();        //! calibre sensor
-    static uint32_t getCurrentValue();  //! check bevor calibrte quick
+    static void init();                        //! init the startic object
+    static void requestZeroCalib();            //! zero point at the next round (calibration key)
+    static ZeroCalib getZeroCalib()            //! state of the zero calibration
+    {
+      return PrSensor::zeroCalib;
+    }
+    static void requestCalibPoint( int32_t );  //! take a point of the calibration curve (mbar)
+    static void setAutoZero( bool );           //! switch the zero tracking, save
+    static bool getAutoZero()                  //! zero tracking on?
+    {
+      return PrSensor::autoZeroOn;
+    }
+    static int32_t getZeroShiftQ4()            //! tracked zero shift, 1/16 mV
+    {
+      return PrSensor::autoZero.getShiftQ4();
+    }
+    static uint32_t getZeroUpdates()           //! shift updates since start
+    {
+      return PrSensor::autoZero.getUpdates();
+    }
+    static SensorState getHealthState()        //! diagnostics of the sensor
+    {
+      return PrSensor::healthState;
+    }
+    static const SensorHealth &getHealth()     //! noise and fault counters
+    {
+      return PrSensor::health;
+    }
+    static size_t getOfflineCount();           //! measures waiting for time sync
+    static uint32_t getOfflineDropped()        //! measures lost while not synced
+    {
+      return PrSensor::offlineDropped;
+    }
+    static int32_t getTempCoefficient()        //! mV per 0.01 °C, Q16.16
+    {
+      return PrSensor::tempComp.getCoefficient();
+    }
+    static uint32_t getTempPairs()             //! measure pairs used for the coefficient
+    {
+      return PrSensor::tempComp.getPairs();
+    }
 
     private:
-    static void start();          //! start measure thread
-    static void mTask( void * );  //! the task for preasure
-    static void doMeasure();      //! make a measure
+    static void start();                                        //! start measure thread
+    static void mTask( void * );                                //! the task for preasure
+    static void doMeasure();                                    //! make a measure
+    static void calibreZero();                                  //! measure, set the zero point if no pressure
+    static void trackZero();                                    //! current measure into the zero tracking
+    static int16_t readTemperature();                           //! chip temperature 0.01 °C
+    static void storeMeasure( const presure_data_t & );         //! to file, journal, upload and live
+    static void bufferOffline( int64_t );                       //! current measure into the offline ring
+    static void restampOffline();                               //! time synced, store the offline measures
+    static presure_data_t restamp( const offline_record_t & );  //! offline measure with wall clock
   };
 
   using pressureObjePtr = std::shared_ptr< PrSensor >;
@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  constexpr uint8_t PUMP_CYCLE_SHORT = 0x01;     //! flag: on time or distance to the cycle before too short
+  constexpr uint16_t PUMP_OFF_UNKNOWN = 0xffff;  //! no cycle before (or longer than 18 h)
+
+  //
+  // one pump cycle, record of the cycle log (binary, little endian)
+  //
+  struct pump_cycle_t
+  {
+    uint32_t start;       //! UTC secounds, last measure before the rise
+    uint16_t onSec;       //! start to the peak
+    uint16_t offSec;      //! end of the cycle before to this start
+    int16_t startMbar;    //! pressure at start (cut in)
+    int16_t peakMbar;     //! pressure at the peak (cut out)
+    int16_t rateMbarMin;  //! recovery rate while on
+    uint8_t flags;        //! PUMP_CYCLE_*
+    uint8_t reserved;     //! 0
+  };
+  static_assert( sizeof( pump_cycle_t ) == 16, "pump cycle record layout changed!" );
+
+  //
+  // limits for the cycle detector (from appPrefs on the device)
+  //
+  struct pump_cycle_params_t
+  {
+    int32_t startMbar;        //! rise between two measures: pump on
+    int32_t stopMbar;         //! less rise: pump off (peak reached)
+    uint32_t maxGapS;         //! more time between measures: cycle lost
+    uint32_t shortOnS;        //! on time below: short cycle
+    uint32_t shortDistanceS;  //! start closer to the end of the cycle before: short cycle
+  };
+
+  //
+  // edge / state detector for pump cycles on the measures, O(1) memory
+  // OFF -> ON with a rising edge, ON -> OFF if the pressure rises no more;
+  // the resolution of the times is the measure interval
+  // no Arduino dependency
+  //
+  class PumpCycleDetector
+  {
+    private:
+    pump_cycle_params_t params;  //! limits
+    bool hasLast;                //! last measure valid
+    uint32_t lastSec;            //! time of the measure before
+    int32_t lastMbar;            //! pressure of the measure before
+    bool pumpOn;                 //! inside a cycle
+    pump_cycle_t cycle;          //! the running cycle
+    uint32_t peakSec;            //! time of the highest pressure in the cycle
+    uint32_t lastEndSec;         //! end of the cycle before, 0 == none
+
+    public:
+    explicit PumpCycleDetector( const pump_cycle_params_t & );
+    bool update( uint32_t, int32_t, pump_cycle_t & );  //! measure (UTC s, mbar), true with a finished cycle
+    bool isOn() const                                  //! pump runs
+    {
+      return pumpOn;
+    }
+  };
+}  // namespace measure_h2o
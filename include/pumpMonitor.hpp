@@ -0,0 +1,53 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "appPrefs.hpp"
+#include "pumpCycles.hpp"
+
+namespace measure_h2o
+{
+  //
+  // pump cycles from the measures with valid time (measure task)
+  // every cycle goes as 16 byte record into its own log file (PUMP_LOG_FILE),
+  // if full the log is moved to PUMP_LOG_OLD_FILE; short cycles are counted
+  // (early warning for a pressure tank without air)
+  //
+  class PumpMonitor
+  {
+    private:
+    static const char *tag;              //! name of the module for debug
+    static SemaphoreHandle_t logSem;     //! log file (measure task vs. http)
+    static portMUX_TYPE cycleMux;        //! protect the last cycle
+    static PumpCycleDetector detector;   //! edge / state detector
+    static pump_cycle_t lastCycle;       //! newest finished cycle
+    static uint32_t cycleCount;          //! cycles since start
+    static uint32_t shortCount;          //! short cycles since start
+    static uint32_t logErrors;           //! records not written
+
+    public:
+    static void init();                                  //! init the static object
+    static void process( uint32_t, int32_t );            //! measure (UTC secounds, mbar)
+    static bool isOn()                                   //! pump runs
+    {
+      return PumpMonitor::detector.isOn();
+    }
+    static uint32_t getCycles()                          //! cycles since start
+    {
+      return PumpMonitor::cycleCount;
+    }
+    static uint32_t getShortCycles()                     //! short cycles since start
+    {
+      return PumpMonitor::shortCount;
+    }
+    static uint32_t getLogErrors()                       //! records not written
+    {
+      return PumpMonitor::logErrors;
+    }
+    static bool getLastCycle( pump_cycle_t & );          //! newest cycle, false if none
+    static size_t readLast( pump_cycle_t *, size_t );    //! newest records of the log (oldest first)
+
+    private:
+    static bool append( const pump_cycle_t & );          //! record into the log
+  };
+}  // namespace measure_h2o
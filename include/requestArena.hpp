@@ -0,0 +1,69 @@
+#pragma once
+#include <stdarg.h>
+#include <Arduino.h>
+#include "ESPAsyncWebServer.h"
+#include "appPrefs.hpp"
+
+namespace measure_h2o
+{
+  class RequestArena;
+  using arena_release_t = void ( * )();
+  using arena_fill_t = bool ( * )( RequestArena &, size_t );  //! write part n into the empty block, false if no more parts
+
+  //
+  // per request memory for building responses (text, metrics, json)
+  // fixed pool of static blocks, no heap; a block belongs to one request
+  // and is free again if the request is gone (disconnect)
+  // the body grows with a bump pointer and is sent without copy
+  // larger bodies are sent chunked, the block holds one part at a time
+  // only in the async_tcp task (handlers, onDisconnect)
+  //
+  class RequestArena : public Print
+  {
+    private:
+    static const char *tag;                           //! name of the module for debug
+    static RequestArena pool[ prefs::ARENA_BLOCKS ];  //! the blocks
+    static uint32_t usedCount;                        //! blocks in use
+    static uint32_t usedPeak;                         //! max blocks in use
+    static uint32_t exhaustedCount;                   //! requests without block
+    AsyncWebServerRequest *owner;                     //! request or nullptr if free
+    arena_release_t onRelease;                        //! call if the request is gone
+    size_t head;                                      //! end of the body
+    size_t tail;                                      //! chunked: bytes of the part already sent
+    arena_fill_t filler;                              //! chunked: writes the parts, nullptr if done
+    size_t part;                                      //! chunked: number of the next part
+    bool overflow;                                    //! body was too large for the block
+    char block[ prefs::ARENA_BLOCK_SIZE ];            //! the memory
+
+    public:
+    RequestArena() : owner( nullptr ), onRelease( nullptr ), head( 0 ), tail( 0 ), filler( nullptr ), part( 0 ), overflow( false )
+    {
+    }
+    static RequestArena *get( AsyncWebServerRequest * );         //! block of the request, nullptr if all in use
+    static uint32_t getUsedCount()                               //! blocks in use
+    {
+      return RequestArena::usedCount;
+    }
+    static uint32_t getUsedPeak()                                //! max blocks in use
+    {
+      return RequestArena::usedPeak;
+    }
+    static uint32_t getExhaustedCount()                          //! requests without block
+    {
+      return RequestArena::exhaustedCount;
+    }
+    size_t write( uint8_t ) override;                            //! append a char (Print)
+    size_t write( const uint8_t *, size_t ) override;            //! append bytes (Print)
+    bool append( const char *, ... );                            //! append formatted text
+    bool vappend( const char *, va_list );                       //! append formatted text
+    const char *c_str();                                         //! body as string
+    void setOnRelease( arena_release_t );                        //! call if the request is gone
+    AsyncWebServerResponse *beginResponse( int, const char * );  //! response from the body, no copy
+    void send( int, const char * );                              //! send the body
+    void sendChunked( const char *, arena_fill_t );              //! send the parts, one block at a time
+
+    private:
+    void release();                         //! request is gone, block is free
+    size_t fillChunk( uint8_t *, size_t );  //! next bytes of the chunked body, 0 == end
+  };
+}  // namespace measure_h2o
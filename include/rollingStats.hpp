@@ -0,0 +1,25 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "appPrefs.hpp"
+#include "rollingWindow.hpp"
+
+namespace measure_h2o
+{
+  //
+  // rolling statistics of the pressure (mbar) over the windows of STATS_WINDOW_S,
+  // fed by the measure task, read by the webserver (summary panels without history)
+  //
+  class RollingStats
+  {
+    private:
+    static portMUX_TYPE statsMux;                                 //! protect the windows (measure task vs. http)
+    static RollingWindow windows[ prefs::STATS_WINDOW_COUNT ];    //! one per span
+    static const char *const names[ prefs::STATS_WINDOW_COUNT ];  //! span as text
+
+    public:
+    static void add( int32_t );                    //! measure (mbar), time is the uptime
+    static bool get( size_t, rolling_stats_t & );  //! aggregates of window idx until now
+    static const char *getName( size_t );          //! span of window idx as text
+  };
+}  // namespace measure_h2o
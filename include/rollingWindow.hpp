@@ -0,0 +1,69 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  //
+  // aggregates of one window
+  //
+  struct rolling_stats_t
+  {
+    uint32_t count;        //! samples in the window
+    int32_t min;           //! smallest sample
+    int32_t max;           //! largest sample
+    int32_t meanCenti;     //! mean, 1/100 of the sample unit
+    uint32_t stddevCenti;  //! standard deviation, 1/100 of the sample unit
+  };
+
+  //
+  // sliding window over integer samples in BUCKETS time buckets, O(1) memory and time per sample
+  // - count, sum and sum of squares are exact (integers, no cancellation like float sums),
+  //   closed buckets are added to the window totals and subtracted again when they expire
+  // - min and max over the closed buckets with monotonic deques of the bucket numbers
+  // the window slides in steps of one bucket (span / BUCKETS)
+  // no Arduino dependency
+  //
+  class RollingWindow
+  {
+    public:
+    static constexpr size_t BUCKETS = 12;  //! buckets of one window
+
+    private:
+    struct bucket_t
+    {
+      uint32_t count;  //! samples in the bucket
+      int64_t sum;     //! sum of the samples
+      int64_t sumSq;   //! sum of the squares
+      int32_t min;     //! smallest sample
+      int32_t max;     //! largest sample
+    };
+    uint32_t bucketSec;            //! length of a bucket
+    bucket_t buckets[ BUCKETS ];   //! ring, bucket number % BUCKETS
+    uint32_t current;              //! number of the current (open) bucket
+    bool started;                  //! first sample was there
+    uint32_t totCount;             //! totals of the closed buckets in the window
+    int64_t totSum;
+    int64_t totSumSq;
+    uint32_t minQueue[ BUCKETS ];  //! bucket numbers, rising min
+    size_t minHead;
+    size_t minLen;
+    uint32_t maxQueue[ BUCKETS ];  //! bucket numbers, falling max
+    size_t maxHead;
+    size_t maxLen;
+
+    public:
+    explicit RollingWindow( uint32_t );   //! span of the window in secounds
+    void add( uint32_t, int32_t );        //! sample (secounds, value)
+    void advance( uint32_t );             //! move the window to the time, expire old buckets
+    void get( rolling_stats_t & ) const;  //! aggregates of the window
+    uint32_t getSpan() const              //! span of the window in secounds
+    {
+      return bucketSec * BUCKETS;
+    }
+
+    private:
+    void closeCurrent();                  //! current bucket into totals and deques
+    void expire();                        //! oldest bucket out of totals and deques
+  };
+}  // namespace measure_h2o
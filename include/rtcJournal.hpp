@@ -0,0 +1,41 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+
+namespace measure_h2o
+{
+  //
+  // write-ahead journal for measures, ring in RTC memory (survives soft reset, panic, watchdog)
+  // every measure is appended before it waits in FileService::dataset, the file service
+  // commits the records written into the day file; after a reboot the not committed
+  // records are replayed (at least once, a crash between write and commit makes a double line)
+  //
+  class RtcJournal
+  {
+    private:
+    static const char *tag;          //! name of the module for debug
+    static portMUX_TYPE journalMux;  //! protect the journal (measure task vs. file task)
+    static uint32_t replayedCount;   //! records replayed at boot
+    static uint32_t lostCount;       //! records overwritten before commit
+
+    public:
+    static void init( presure_data_set_t & );      //! check the journal, replay records into the set
+    static void append( const presure_data_t & );  //! new measure
+    static void commit( size_t );                  //! the oldest records are saved
+    static size_t getPendingCount();               //! records not saved
+    static uint32_t getReplayedCount()             //! records replayed at boot
+    {
+      return RtcJournal::replayedCount;
+    }
+    static uint32_t getLostCount()                 //! records overwritten before commit
+    {
+      return RtcJournal::lostCount;
+    }
+
+    private:
+    static void reset();          //! empty journal
+    static uint32_t headerCrc();  //! crc of the header
+  };
+}  // namespace measure_h2o
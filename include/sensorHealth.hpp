@@ -0,0 +1,76 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  //
+  // health of the pressure sensor, worst first after OK
+  //
+  enum class SensorState : uint8_t
+  {
+    OK,     //! plausible readings
+    OPEN,   //! near 0 V, wire broken or sensor without supply
+    SHORT,  //! near the ADC top, short to supply
+    NOISY,  //! readings of one measure scatter (loose contact, floating input)
+    STUCK   //! exact the same reading for a long time
+  };
+
+  //
+  // limits for the diagnostics (from appPrefs on the device)
+  //
+  struct sensor_health_params_t
+  {
+    uint32_t openMv;        //! mean below: open
+    uint32_t shortMv;       //! mean above: short
+    uint32_t noiseMv;       //! standard deviation of a burst above: noisy
+    uint32_t stuckCount;    //! identical measures for stuck
+    uint32_t confirmCount;  //! same result this often before the state changes
+  };
+
+  //
+  // diagnostics of the sensor from the oversampled burst of every measure:
+  // rail (open / short), scatter inside the burst, identical readings over time
+  // a new state needs confirmCount measures in a row (no flicker)
+  // integer only, no Arduino dependency
+  //
+  class SensorHealth
+  {
+    private:
+    sensor_health_params_t params;  //! limits
+    SensorState state;              //! confirmed state
+    SensorState candidate;          //! state of the last measures
+    uint32_t candidateCount;        //! measures in a row with the candidate
+    uint32_t lastMean;              //! mean of the last burst
+    uint32_t sameCount;             //! bursts in a row without any change
+    uint32_t spreadMv;              //! max - min of the last burst
+    uint32_t noiseCentiMv;          //! standard deviation of the last burst, 0.01 mV
+    uint32_t noiseAvgCentiMv;       //! average of the standard deviation (1/8 per measure)
+    uint32_t faults;                //! changes from OK into a fault
+
+    public:
+    explicit SensorHealth( const sensor_health_params_t & );
+    bool check( const uint16_t *, size_t );  //! burst of one measure, true if the state changed
+    SensorState getState() const             //! confirmed state
+    {
+      return state;
+    }
+    uint32_t getSpreadMv() const             //! max - min of the last burst
+    {
+      return spreadMv;
+    }
+    uint32_t getNoiseCentiMv() const         //! standard deviation of the last burst, 0.01 mV
+    {
+      return noiseCentiMv;
+    }
+    uint32_t getNoiseAvgCentiMv() const      //! average standard deviation, 0.01 mV
+    {
+      return noiseAvgCentiMv;
+    }
+    uint32_t getFaults() const               //! faults since start
+    {
+      return faults;
+    }
+    static const char *getName( SensorState );  //! short name (metrics, json)
+  };
+}  // namespace measure_h2o
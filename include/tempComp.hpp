@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace measure_h2o
+{
+  //
+  // limits for the temperature compensation (from appPrefs on the device)
+  //
+  struct temp_comp_params_t
+  {
+    int32_t refCentiC;      //! reference temperature, 0.01 °C
+    uint32_t stableMv;      //! max change of tension between measures for learning
+    int32_t minStepCentiC;  //! min change of temperature between measures for learning
+    int64_t minSumXX;       //! min temperature variation (sum dT²) before k is computed
+    int64_t maxSumXX;       //! sums are halved if more (forget old pairs)
+    int32_t maxCoeffQ16;    //! limit for k (both signs)
+  };
+
+  //
+  // temperature compensation of the sensor tension, integer only
+  // mV(compensated) = mV(raw) - k * ( T - T(ref) ), k in mV per 0.01 °C as Q16.16
+  // k is learned from consecutive measures with stable pressure: the change of the
+  // tension against the change of the temperature (least squares through zero, so
+  // different pressure levels between the quiet times don't count)
+  // no Arduino dependency, can be built and checked on the host
+  //
+  class TempComp
+  {
+    public:
+    static constexpr int16_t TEMP_UNKNOWN = -32768;  //! no temperature (e.g. old records)
+
+    private:
+    temp_comp_params_t params;  //! limits
+    int32_t coeffQ16;           //! k, mV per 0.01 °C, Q16.16
+    int64_t sumXY;              //! sum dT * dmV
+    int64_t sumXX;              //! sum dT * dT
+    uint32_t pairs;             //! pairs in the sums
+    int16_t lastCentiC;         //! temperature of the last measure
+    uint32_t lastMv;            //! raw tension of the last measure
+
+    public:
+    explicit TempComp( const temp_comp_params_t & );
+    void setCoefficient( int32_t );                  //! k (e.g. from NVS), limited
+    int32_t getCoefficient() const                   //! k, mV per 0.01 °C, Q16.16
+    {
+      return coeffQ16;
+    }
+    uint32_t getPairs() const                        //! pairs used for learning
+    {
+      return pairs;
+    }
+    bool learn( int16_t, uint32_t );                 //! add a measure (raw), true if k was new computed
+    uint32_t compensate( uint32_t, int16_t ) const;  //! compensated tension
+  };
+}  // namespace measure_h2o
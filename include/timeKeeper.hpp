@@ -0,0 +1,51 @@
+#pragma once
+#include <time.h>
+#include <sys/time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+
+namespace measure_h2o
+{
+  //
+  // one clock for the app: monotonic esp_timer microsecounds plus an offset to UTC,
+  // calibrated at every NTP sync; between two syncs the drift of the esp_timer
+  // against NTP (ppm) is measured and corrected
+  //
+  class TimeKeeper
+  {
+    private:
+    static const char *tag;            //! name of the module for debug
+    static portMUX_TYPE timeMux;       //! protect the calibration (sntp task vs. readers)
+    static bool synced;                //! was synced once, wall clock valid
+    static int64_t offsetYs;           //! UTC = monotonic + offset (at the last sync)
+    static int64_t syncMonoYs;         //! monotonic time of the last sync
+    static int64_t driftBaseMonoYs;    //! monotonic time of the last drift sample
+    static int64_t driftBaseOffsetYs;  //! offset at the last drift sample
+    static float driftPpm;             //! filtered drift, positive: esp_timer slower than NTP
+    static int64_t lastErrorYs;        //! difference corrected clock to NTP at the last sync
+    static uint32_t syncCount;         //! count of syncs
+    static uint32_t driftCount;        //! count of drift samples
+
+    public:
+    static void onSync( const struct timeval * );  //! NTP sync, calibrate offset and drift
+    static bool isSynced()                         //! wall clock valid
+    {
+      return TimeKeeper::synced;
+    }
+    static time_stamp_t stamp();                   //! now, both clocks
+    static int64_t toWallYs( int64_t );            //! monotonic to UTC microsecounds, 0 if not synced
+    static time_t now();                           //! UTC secounds, 0 if not synced
+    static void toLocal( time_t, struct tm & );    //! local time of a timestamp
+    static float getDriftPpm();                    //! drift estimate
+    static int32_t getLastErrorMs();               //! error of the corrected clock at the last sync
+    static uint32_t getSyncCount()                 //! count of syncs
+    {
+      return TimeKeeper::syncCount;
+    }
+
+    private:
+    static int64_t wallYs( int64_t );  //! monotonic to UTC, without lock
+  };
+}  // namespace measure_h2o
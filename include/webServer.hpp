@@ -4,14 +4,37 @@
 #include <AsyncTCP.h>
 // #include <PrometheusArduino.h>
 #include "ESPAsyncWebServer.h"
+#include "appPrefs.hpp"
+#include "appStructs.hpp"
+#include "jsonWriter.hpp"
+#include "requestArena.hpp"
+#include "apiRoute.hpp"
 
 namespace measure_h2o
 {
+  //
+  // one entry of the content type table
+  //
+  struct content_type_t
+  {
+    const char *suffix;  //! end of the filename
+    const char *marker;  //! short name for the type
+    const char *type;    //! http content type
+  };
+
   class APIWebServer
   {
     private:
-    static const char *tag;        //! for debugging
-    static AsyncWebServer server;  //! webserver ststic
+    static const char *tag;                      //! for debugging
+    static AsyncWebServer server;                //! webserver ststic
+    static const api_route_t apiRoutes[];        //! route table api version 1
+    static const content_type_t contentTypes[];  //! content types by file suffix
+    static uint32_t inFlight;                    //! running file responses
+    static uint32_t inFlightPeak;                //! max running file responses
+    static uint32_t rejectedCount;               //! requests rejected (busy)
+
+    //! values for the template placeholders
+    static char tmplValues[ static_cast< size_t >( TmplVar::COUNT ) ][ prefs::WWW_TMPL_VALUE_LEN ];
 
     public:
     static void init();   //! init http server
@@ -19,24 +42,58 @@ namespace measure_h2o
     static void stop();   //! server stop
 
     private:
-    static void onIndex( AsyncWebServerRequest * );                               //! on index ("/" or "/index.html")
-    static void onApiV1( AsyncWebServerRequest * );                               //! on url path "/api/v1/"
-    static void onApiV1Set( AsyncWebServerRequest * );                            //! set a few things vis REST
-    static void onFilesReq( AsyncWebServerRequest * );                            //! on some file
-    static void apiGetTodayData( AsyncWebServerRequest * );                       //! on api get today data
-    static void apiGetRestInterval( AsyncWebServerRequest * );                    //! on api get mesure interval
-    static void apiGetRestDataFileFrom( AsyncWebServerRequest * );                //! get data file from date (if availible)
-    static void apiGetRestFilesystemCheck( AsyncWebServerRequest * );             //! trigger the filesystem checker...
-    static void apiGetRestFilesystemStatus( AsyncWebServerRequest * );            //! get an overview for filesystem as json
-    static void apiGetRestLedBrightness( AsyncWebServerRequest * );               //! get LED Stripe brightness
-    static void apiGetRestFlashAmount( AsyncWebServerRequest * );                 //! get flash amount's
-    static void onGetMetrics( AsyncWebServerRequest * );                          //! get sensors metrics
-    static void deliverFileToHttpd( String &, AsyncWebServerRequest * );          //! deliver content file via http
-    static void handleNotPhysicFileSources( String &, AsyncWebServerRequest * );  //! handle virtual files/paths
-    static String setContentTypeFromFile( String &, const String & );             //! find content type
-    static void onNotFound( AsyncWebServerRequest * );                            //! if page not found
-    static void onServerError( AsyncWebServerRequest *, int, const String & );    //! if server error
-    static String tProcessor( const String & );                                   //! minimalistic template processor
+    static void onIndex( AsyncWebServerRequest * );                                        //! on index ("/" or "/index.html")
+    static void onApiV1( AsyncWebServerRequest * );                                        //! on url path "/api/v1/"
+    static const char *lookupParam( void *, const char * );                                //! request parameter for the dispatcher
+    static bool admitRequest( AsyncWebServerRequest * );                                   //! admission control, 503 if busy
+    static void releaseRequest();                                                          //! admitted request is gone
+    static void sendBusy( AsyncWebServerRequest * );                                       //! 503 with Retry-After
+    static void sendText( AsyncWebServerRequest *, int, const char *, ... );               //! formatted text via request block
+    static void onFilesReq( AsyncWebServerRequest * );                                     //! on some file
+    static void apiGetTodayData( AsyncWebServerRequest *, const api_arg_t & );             //! on api get today data
+    static void apiGetRestInterval( AsyncWebServerRequest *, const api_arg_t & );          //! on api get mesure interval
+    static void apiGetSince( AsyncWebServerRequest *, const api_arg_t & );                 //! records after a cursor
+    static void apiGetRestDataFileFrom( AsyncWebServerRequest *, const api_arg_t & );      //! get data file from date (if availible)
+    static void apiGetRestFilesystemCheck( AsyncWebServerRequest * );                      //! trigger the filesystem checker...
+    static void apiGetRestFilesystemStatus( AsyncWebServerRequest *, const api_arg_t & );  //! get an overview for filesystem as json
+    static void apiGetRestStatus( AsyncWebServerRequest *, const api_arg_t & );            //! all states as json
+    static void apiGetRestHeapHistory( AsyncWebServerRequest *, const api_arg_t & );       //! heap monitor samples as json
+    static void apiGetRestAnomalies( AsyncWebServerRequest *, const api_arg_t & );         //! anomaly events and detector as json
+    static void apiGetRestPumpCycles( AsyncWebServerRequest *, const api_arg_t & );        //! pump cycle counters and log as json
+    static void writeFilesystemStatus( JsonWriter & );                                     //! flash and day files as json
+    static const char *getWlanStateName( WlanState );                                      //! WLAN state as text
+    static void apiGetRestLedBrightness( AsyncWebServerRequest *, const api_arg_t & );     //! get LED Stripe brightness
+    static void apiGetRestFlashAmount( AsyncWebServerRequest *, const api_arg_t & );       //! get flash amount's
+    static void apiSetTimezone( AsyncWebServerRequest *, const api_arg_t & );              //! set timezone (name)
+    static void apiSetTimezoneOffset( AsyncWebServerRequest *, const api_arg_t & );        //! set timezone offset (secounds)
+    static void apiSetLoglevel( AsyncWebServerRequest *, const api_arg_t & );              //! set loglevel
+    static void apiSetInterval( AsyncWebServerRequest *, const api_arg_t & );              //! set measure interval
+    static void apiSetLedBrightness( AsyncWebServerRequest *, const api_arg_t & );         //! set led stripe brightness
+    static void apiSetUploadUrl( AsyncWebServerRequest *, const api_arg_t & );             //! set url for push uploads
+    static void apiSetFilesystemCheck( AsyncWebServerRequest *, const api_arg_t & );       //! force filesystem check
+    static void apiSetCalibPoint( AsyncWebServerRequest *, const api_arg_t & );            //! point of the calibration curve
+    static void apiSetCalibClear( AsyncWebServerRequest *, const api_arg_t & );            //! remove the calibration curve
+    static void apiSetAutoZero( AsyncWebServerRequest *, const api_arg_t & );              //! switch the zero tracking
+    static void apiSetAnomalyAck( AsyncWebServerRequest *, const api_arg_t & );            //! stop showing the anomaly
+    static void onGetMetrics( AsyncWebServerRequest * );                                   //! get sensors metrics
+    static bool fillMetrics( RequestArena &, size_t );                                     //! part of the metrics (chunked)
+    static void deliverFileToHttpd( String &, AsyncWebServerRequest * );                   //! deliver content file via http
+    static void deliverDataFile( String &, AsyncWebServerRequest * );                      //! deliver day file, range/conditional
+    static void formatHttpDate( char *, size_t, time_t );                                  //! time as http date
+    static time_t parseHttpDate( const char * );                                           //! http date to time
+    static void deliverWwwAsset( const www_asset_t &, AsyncWebServerRequest * );           //! deliver web file, gzip/etag
+    static void deliverTemplate( const www_template_t &, AsyncWebServerRequest * );        //! deliver html template
+    static size_t fillTemplate( const www_template_t &, uint8_t *, size_t, size_t );       //! render part of a template
+    static String setContentTypeFromFile( String &, const String & );                      //! find content type
+    static void onNotFound( AsyncWebServerRequest * );                                     //! if page not found
+    static void onServerError( AsyncWebServerRequest *, int, const char *, ... );          //! if server error (formatted)
+    static void initTemplateValues();                                                      //! values for the template placeholders
+
+    // metric lines for onGetMetrics, numbers without printf
+    static void appendMetric( RequestArena &, const char *, const char *, uint32_t, uint8_t = 8 );  //! unsigned, leading zeros
+    static void appendMetricFixed( RequestArena &, const char *, const char *, float, uint8_t );    //! with decimals, NaN if invalid
+    static void appendMetricValue( RequestArena &, const char *, const char *, const char * );      //! formatted value
+    static void appendRollingStats( RequestArena &, size_t );                                       //! lines of one window
   };
 
 }  // namespace measure_h2o
@@ -0,0 +1,490 @@
+#pragma once
+//
+// generated by tools/makeWww.py, do not edit
+//
+#include <Arduino.h>
+#include "appStructs.hpp"
+
+namespace measure_h2o
+{
+  const uint8_t WWW_INDEX_HTML[] PROGMEM = {
+      0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+      0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x64, 0x65, 0x2d, 0x44,
+      0x45, 0x22, 0x3e, 0x0a, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x74,
+      0x69, 0x74, 0x6c, 0x65, 0x3e, 0x57, 0x41, 0x53, 0x53, 0x45, 0x52, 0x44, 0x52, 0x55, 0x43, 0x4b,
+      0x20, 0x41, 0x70, 0x70, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+      0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x65, 0x73, 0x63, 0x72,
+      0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+      0x22, 0x77, 0x61, 0x74, 0x65, 0x72, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20,
+      0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d,
+      0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72,
+      0x64, 0x73, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x73, 0x61, 0x76,
+      0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x75, 0x72, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73,
+      0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d,
+      0x65, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+      0x6e, 0x74, 0x3d, 0x22, 0x44, 0x69, 0x72, 0x6b, 0x20, 0x4d, 0x61, 0x72, 0x63, 0x69, 0x6e, 0x69,
+      0x61, 0x6b, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e,
+      0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63,
+      0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65,
+      0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74,
+      0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a,
+      0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x53, 0x53, 0x20, 0x53, 0x74, 0x79, 0x6c, 0x65,
+      0x73, 0x20, 0x61, 0x70, 0x70, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e,
+      0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65,
+      0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x70, 0x72, 0x65, 0x73, 0x75, 0x72, 0x65,
+      0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x0a,
+      0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x48, 0x31, 0x3e, 0x57, 0x61, 0x73,
+      0x73, 0x65, 0x72, 0x64, 0x72, 0x75, 0x63, 0x6b, 0x3c, 0x2f, 0x48, 0x31, 0x3e, 0x0a, 0x20, 0x20,
+      0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74,
+      0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x75, 0x6c, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+      0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x6b, 0x74, 0x75,
+      0x65, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x44, 0x72, 0x75, 0x63, 0x6b, 0x3a, 0x20, 0x3c, 0x73, 0x70,
+      0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x76, 0x65, 0x2d, 0x62, 0x61, 0x72, 0x22,
+      0x3e, 0x2d, 0x2e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x20, 0x62, 0x61, 0x72,
+      0x20, 0x28, 0x67, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x74, 0x20, 0x3c, 0x73, 0x70, 0x61,
+      0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x76, 0x65, 0x2d, 0x66, 0x69, 0x6c, 0x74, 0x65,
+      0x72, 0x65, 0x64, 0x22, 0x3e, 0x2d, 0x2e, 0x2d, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e,
+      0x20, 0x62, 0x61, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
+      0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22, 0x3e,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70, 0x69,
+      0x2f, 0x76, 0x31, 0x2f, 0x6c, 0x69, 0x76, 0x65, 0x22, 0x20, 0x28, 0x53, 0x65, 0x72, 0x76, 0x65,
+      0x72, 0x20, 0x53, 0x65, 0x6e, 0x74, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x29, 0x0a, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x20,
+      0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x68,
+      0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x72, 0x20, 0x53, 0x6f, 0x66, 0x74,
+      0x77, 0x61, 0x72, 0x65, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64,
+      0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f,
+      0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x0a, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x20, 0x68,
+      0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x69, 0x6e, 0x66, 0x6f, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x6f, 0x6e, 0x74,
+      0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x2f, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x49, 0x6e,
+      0x66, 0x6f, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x69, 0x6e,
+      0x66, 0x6f, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+      0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x3c, 0x61,
+      0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x69,
+      0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x45, 0x72, 0x66, 0x72, 0x61, 0x67, 0x65, 0x20, 0x49, 0x6e, 0x74, 0x65,
+      0x72, 0x76, 0x61, 0x6c, 0x6c, 0x20, 0x64, 0x65, 0x72, 0x20, 0x4d, 0x65, 0x73, 0x73, 0x75, 0x6e,
+      0x67, 0x65, 0x6e, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+      0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f,
+      0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x22,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76,
+      0x31, 0x2f, 0x74, 0x6f, 0x64, 0x61, 0x79, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x44, 0x61, 0x74, 0x65, 0x6e, 0x20, 0x76, 0x6f, 0x6e, 0x20, 0x48, 0x45,
+      0x55, 0x54, 0x45, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65,
+      0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61,
+      0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x74, 0x6f, 0x64, 0x61, 0x79, 0x22, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c,
+      0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72,
+      0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x64, 0x61, 0x74, 0x61,
+      0x3f, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x32, 0x30, 0x32, 0x34, 0x2d, 0x30, 0x36, 0x2d, 0x30, 0x36,
+      0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x61, 0x74,
+      0x65, 0x6e, 0x20, 0x76, 0x6f, 0x6d, 0x20, 0x44, 0x61, 0x74, 0x75, 0x6d, 0x20, 0x59, 0x59, 0x59,
+      0x59, 0x2d, 0x4d, 0x4d, 0x2d, 0x44, 0x44, 0x20, 0x28, 0x59, 0x65, 0x61, 0x72, 0x2c, 0x20, 0x4d,
+      0x6f, 0x6e, 0x74, 0x68, 0x2c, 0x20, 0x44, 0x61, 0x79, 0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+      0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x64, 0x61, 0x74,
+      0x61, 0x3f, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x32, 0x30, 0x32, 0x34, 0x2d, 0x30, 0x37, 0x2d, 0x30,
+      0x36, 0x22, 0x20, 0x44, 0x61, 0x74, 0x65, 0x6e, 0x20, 0x76, 0x6f, 0x6d, 0x20, 0x30, 0x36, 0x2e,
+      0x30, 0x37, 0x2e, 0x32, 0x30, 0x32, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3f,
+      0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x31, 0x2d, 0x30, 0x33, 0x22,
+      0x20, 0x44, 0x61, 0x74, 0x65, 0x6e, 0x20, 0x76, 0x6f, 0x6d, 0x20, 0x30, 0x33, 0x2e, 0x30, 0x31,
+      0x2e, 0x32, 0x30, 0x32, 0x35, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+      0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76,
+      0x31, 0x2f, 0x6c, 0x65, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x48, 0x65, 0x6c, 0x6c, 0x69, 0x67, 0x6b, 0x65, 0x69, 0x74, 0x20, 0x64, 0x65, 0x73,
+      0x20, 0x4c, 0x45, 0x44, 0x20, 0x53, 0x74, 0x72, 0x69, 0x70, 0x65, 0x20, 0x28, 0x30, 0x20, 0x2d,
+      0x20, 0x32, 0x35, 0x35, 0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f,
+      0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
+      0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x6c, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d,
+      0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x74, 0x69, 0x6d,
+      0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x3f, 0x74, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x2d, 0x6f,
+      0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x33, 0x36, 0x30, 0x30, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x74, 0x7a, 0x74, 0x65, 0x20, 0x5a, 0x65,
+      0x69, 0x74, 0x7a, 0x6f, 0x68, 0x6e, 0x65, 0x20, 0x28, 0x68, 0x69, 0x65, 0x72, 0x20, 0x42, 0x65,
+      0x72, 0x6c, 0x69, 0x6e, 0x2c, 0x20, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x7a, 0x65, 0x69, 0x74,
+      0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62,
+      0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69,
+      0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f,
+      0x76, 0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x3f,
+      0x74, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d,
+      0x33, 0x36, 0x30, 0x30, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+      0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70,
+      0x69, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e,
+      0x65, 0x3f, 0x74, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x73, 0x65,
+      0x74, 0x3d, 0x37, 0x32, 0x30, 0x30, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x53, 0x65, 0x74, 0x7a, 0x74, 0x65, 0x20, 0x5a, 0x65, 0x69, 0x74, 0x7a, 0x6f,
+      0x68, 0x6e, 0x65, 0x20, 0x28, 0x68, 0x69, 0x65, 0x72, 0x20, 0x42, 0x65, 0x72, 0x6c, 0x69, 0x6e,
+      0x2c, 0x20, 0x53, 0x6f, 0x6d, 0x6d, 0x65, 0x72, 0x7a, 0x65, 0x69, 0x74, 0x29, 0x3c, 0x2f, 0x61,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+      0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x73,
+      0x65, 0x74, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x3f, 0x74, 0x69, 0x6d, 0x65,
+      0x7a, 0x6f, 0x6e, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3d, 0x37, 0x32, 0x30, 0x30,
+      0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31,
+      0x2f, 0x73, 0x65, 0x74, 0x2d, 0x6c, 0x6f, 0x67, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3f, 0x6c, 0x65,
+      0x76, 0x65, 0x6c, 0x3d, 0x37, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x53, 0x65, 0x74, 0x7a, 0x74, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x6c, 0x65, 0x76, 0x65,
+      0x6c, 0x20, 0x64, 0x65, 0x72, 0x20, 0x41, 0x70, 0x70, 0x20, 0x28, 0x76, 0x69, 0x61, 0x20, 0x75,
+      0x73, 0x62, 0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70,
+      0x69, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x6c, 0x6f, 0x67, 0x6c, 0x65, 0x76, 0x65,
+      0x6c, 0x3f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3d, 0x37, 0x22, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e,
+      0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x45, 0x4d, 0x45, 0x52, 0x47, 0x45, 0x4e, 0x43, 0x59, 0x20, 0x3d, 0x20, 0x30, 0x20, 0x3c,
+      0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x41, 0x4c, 0x45, 0x52, 0x54, 0x20, 0x3d, 0x20, 0x31, 0x2c, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x52, 0x49, 0x54, 0x49,
+      0x43, 0x41, 0x4c, 0x20, 0x3d, 0x20, 0x32, 0x2c, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x20, 0x3d,
+      0x20, 0x33, 0x2c, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x57, 0x41, 0x52, 0x4e, 0x49, 0x4e, 0x47, 0x20, 0x3d, 0x20, 0x34, 0x2c,
+      0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x4e, 0x4f, 0x54, 0x49, 0x43, 0x45, 0x20, 0x3d, 0x20, 0x35, 0x2c, 0x3c, 0x62, 0x72, 0x20,
+      0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x46,
+      0x4f, 0x20, 0x3d, 0x20, 0x36, 0x2c, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x42, 0x55, 0x47, 0x20, 0x3d, 0x20, 0x37,
+      0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f,
+      0x73, 0x65, 0x74, 0x2d, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3f, 0x69, 0x6e, 0x74,
+      0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x36, 0x30, 0x30, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x74, 0x7a, 0x74, 0x65, 0x20, 0x4d, 0x65, 0x73,
+      0x73, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x65,
+      0x6b, 0x75, 0x6e, 0x64, 0x65, 0x6e, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+      0x6f, 0x64, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x69, 0x6e, 0x74,
+      0x65, 0x72, 0x76, 0x61, 0x6c, 0x3f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x3d, 0x58,
+      0x58, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76,
+      0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x6c, 0x65, 0x64, 0x3f, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74,
+      0x6e, 0x65, 0x73, 0x73, 0x3d, 0x31, 0x32, 0x38, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x74, 0x7a, 0x74, 0x65, 0x20, 0x48, 0x65, 0x6c, 0x6c,
+      0x69, 0x67, 0x6b, 0x65, 0x69, 0x74, 0x20, 0x64, 0x65, 0x73, 0x20, 0x4c, 0x45, 0x44, 0x20, 0x53,
+      0x74, 0x72, 0x65, 0x69, 0x66, 0x65, 0x6e, 0x73, 0x20, 0x28, 0x30, 0x20, 0x2d, 0x20, 0x32, 0x35,
+      0x35, 0x29, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70,
+      0x69, 0x2f, 0x76, 0x31, 0x2f, 0x73, 0x65, 0x74, 0x2d, 0x6c, 0x65, 0x64, 0x3f, 0x62, 0x72, 0x69,
+      0x67, 0x68, 0x74, 0x6e, 0x65, 0x73, 0x73, 0x3d, 0x58, 0x58, 0x58, 0x22, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c,
+      0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72,
+      0x65, 0x66, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x66, 0x6c, 0x61, 0x73,
+      0x68, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x70,
+      0x65, 0x69, 0x63, 0x68, 0x65, 0x72, 0x61, 0x75, 0x73, 0x6c, 0x61, 0x73, 0x74, 0x75, 0x6e, 0x67,
+      0x20, 0x4d, 0x65, 0x73, 0x73, 0x64, 0x61, 0x74, 0x65, 0x6e, 0x73, 0x70, 0x65, 0x69, 0x63, 0x68,
+      0x65, 0x72, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+      0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x22,
+      0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2f, 0x61, 0x70,
+      0x69, 0x2f, 0x76, 0x31, 0x2f, 0x66, 0x6c, 0x61, 0x73, 0x68, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x75, 0x6c, 0x3e,
+      0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x3c, 0x64, 0x69,
+      0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x6f, 0x74, 0x6e, 0x6f, 0x74,
+      0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x29, 0x20, 0x44, 0x69, 0x72, 0x6b,
+      0x20, 0x4d, 0x61, 0x72, 0x63, 0x69, 0x6e, 0x69, 0x61, 0x6b, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+      0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x20,
+      0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x45, 0x76,
+      0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
+      0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63,
+      0x65, 0x28, 0x22, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x76, 0x31, 0x2f, 0x6c, 0x69, 0x76, 0x65, 0x22,
+      0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e,
+      0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72,
+      0x28, 0x22, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e,
+      0x74, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x4a,
+      0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e,
+      0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+      0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+      0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6c, 0x69, 0x76, 0x65, 0x2d, 0x62, 0x61, 0x72,
+      0x22, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d,
+      0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x62, 0x61, 0x72, 0x2e, 0x74, 0x6f, 0x46, 0x69,
+      0x78, 0x65, 0x64, 0x28, 0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+      0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x6c, 0x69, 0x76, 0x65, 0x2d, 0x66, 0x69,
+      0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x22, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e,
+      0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x66, 0x69,
+      0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32,
+      0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+      0x20, 0x7d, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c,
+      0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e };
+  const uint8_t WWW_INDEX_HTML_GZ[] PROGMEM = {
+      0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbd, 0x57, 0x6d, 0x73, 0xe2, 0x36,
+      0x10, 0xfe, 0x9e, 0x5f, 0xb1, 0xe7, 0x4f, 0x30, 0x13, 0xdb, 0x40, 0x2e, 0x49, 0xa7, 0xb5, 0xc9,
+      0xe4, 0xc0, 0x77, 0xa1, 0x0d, 0xa4, 0x03, 0x49, 0x93, 0xf4, 0x9b, 0x62, 0x2f, 0xa0, 0xc1, 0xb6,
+      0x3c, 0x92, 0x0c, 0x97, 0x74, 0xee, 0xbf, 0x77, 0x65, 0x03, 0xe1, 0x2d, 0xcd, 0xcb, 0x31, 0x65,
+      0x18, 0x90, 0xf5, 0x68, 0x9f, 0x7d, 0x76, 0x25, 0x4b, 0x5a, 0xef, 0x53, 0xfb, 0xaa, 0x75, 0x7d,
+      0xff, 0x67, 0x00, 0x63, 0x9d, 0xc4, 0xcd, 0x03, 0xcf, 0xfc, 0x41, 0xcc, 0xd2, 0x91, 0x6f, 0x45,
+      0x68, 0xb7, 0x03, 0xab, 0x79, 0x40, 0x9d, 0xc8, 0xa2, 0xe6, 0x01, 0x80, 0xa7, 0xb9, 0x8e, 0xb1,
+      0x79, 0x7b, 0x3e, 0x18, 0x04, 0xfd, 0x76, 0xff, 0xa6, 0xf5, 0x07, 0x9c, 0x67, 0x99, 0xe7, 0x96,
+      0xdd, 0x66, 0x40, 0x82, 0x9a, 0x41, 0xca, 0x12, 0x34, 0xe6, 0x2a, 0x94, 0x3c, 0xd3, 0x5c, 0xa4,
+      0x16, 0x84, 0x22, 0xd5, 0x98, 0x6a, 0xdf, 0x9a, 0x31, 0x8d, 0x12, 0x32, 0x89, 0x4a, 0xe5, 0x12,
+      0x21, 0x11, 0x29, 0xd7, 0x42, 0x5a, 0xe0, 0x6e, 0x9a, 0x4f, 0xf0, 0x71, 0x26, 0x64, 0xa4, 0x56,
+      0x6c, 0x15, 0x9b, 0x62, 0x61, 0x6a, 0x2c, 0xa7, 0x2c, 0xce, 0x51, 0xed, 0x30, 0x64, 0xb9, 0x1e,
+      0x1b, 0xc6, 0xa5, 0x59, 0x9b, 0xcb, 0x09, 0x74, 0x99, 0x0c, 0x79, 0xca, 0xd9, 0x64, 0x87, 0xc5,
+      0x94, 0xe3, 0x2c, 0x13, 0x52, 0xaf, 0xca, 0xe4, 0x91, 0x1e, 0xfb, 0x11, 0x4e, 0x79, 0x88, 0x76,
+      0xf1, 0x70, 0x08, 0x64, 0xae, 0x39, 0x8b, 0x6d, 0x15, 0xb2, 0x18, 0xfd, 0xba, 0x53, 0xb3, 0x0a,
+      0xa2, 0x4f, 0xb6, 0x0d, 0xad, 0xc1, 0x00, 0x06, 0xfa, 0x31, 0x46, 0x05, 0x2c, 0xcb, 0xc0, 0xb6,
+      0x0b, 0x24, 0xe6, 0xe9, 0x04, 0x24, 0xc6, 0xa4, 0xbc, 0xc0, 0xc6, 0x88, 0xe4, 0x63, 0x2c, 0x71,
+      0xe8, 0x5b, 0xf3, 0x30, 0x9c, 0x50, 0x29, 0xa2, 0xf1, 0xdc, 0x32, 0xc5, 0x07, 0xde, 0x83, 0x88,
+      0x1e, 0x0b, 0xe3, 0x8b, 0x7a, 0xf3, 0x96, 0x29, 0x85, 0x32, 0x92, 0x79, 0x38, 0xf1, 0x5c, 0x7a,
+      0x36, 0xdd, 0x11, 0x9f, 0x42, 0x18, 0x13, 0xe0, 0x5b, 0x31, 0x57, 0xba, 0x90, 0x40, 0xdd, 0x79,
+      0xbc, 0xa3, 0xb7, 0x90, 0xb0, 0x68, 0x02, 0x9c, 0x4f, 0x74, 0x8e, 0x71, 0x4c, 0xe9, 0x6f, 0x1b,
+      0xca, 0x5f, 0xc1, 0x53, 0x19, 0x4b, 0x81, 0x47, 0xc6, 0x68, 0x8a, 0xf6, 0x03, 0x93, 0x56, 0xd3,
+      0x76, 0x6c, 0xdb, 0x73, 0x0d, 0xd0, 0x04, 0xea, 0x80, 0xca, 0x08, 0x87, 0x3c, 0xa6, 0x39, 0xd3,
+      0x9b, 0xc3, 0xcb, 0x6e, 0x8c, 0xb6, 0x6c, 0xaa, 0x4b, 0x8f, 0xab, 0x6a, 0x43, 0x11, 0xa1, 0xf5,
+      0x2c, 0x06, 0xc0, 0x72, 0x59, 0xc6, 0xdd, 0x69, 0xdd, 0x35, 0x6c, 0x16, 0x54, 0x06, 0x28, 0xa7,
+      0xa4, 0x6d, 0x40, 0xf9, 0x87, 0x60, 0x4a, 0xbf, 0x6a, 0x85, 0xc8, 0x25, 0xa6, 0x65, 0x50, 0xee,
+      0x73, 0x54, 0x6b, 0x01, 0x7a, 0x6c, 0x9e, 0x5c, 0x97, 0x88, 0x14, 0xad, 0x3b, 0xc7, 0xac, 0xe6,
+      0x35, 0xa7, 0x7f, 0x95, 0x00, 0x44, 0xc6, 0x93, 0x18, 0xea, 0x19, 0x93, 0xe8, 0xb9, 0xac, 0xf9,
+      0x56, 0xc9, 0x6b, 0xc4, 0x1f, 0x96, 0xc7, 0xd3, 0xa1, 0xd8, 0xd6, 0xd6, 0xa2, 0xc5, 0x27, 0x85,
+      0x99, 0x20, 0x77, 0x9e, 0x8b, 0x0e, 0x8d, 0x7b, 0x8f, 0xba, 0x67, 0xde, 0xb7, 0x49, 0x7b, 0x56,
+      0x34, 0x9f, 0x0a, 0x4e, 0xcb, 0x5f, 0xd2, 0x9b, 0xb5, 0xc6, 0x1b, 0xc8, 0xa1, 0x64, 0x23, 0x24,
+      0x35, 0x25, 0x18, 0x17, 0xd9, 0xeb, 0x9a, 0x37, 0x38, 0x1d, 0x61, 0x6a, 0x04, 0xae, 0x11, 0xbf,
+      0xac, 0x71, 0xdb, 0xcf, 0xc1, 0x2e, 0x95, 0xbb, 0x93, 0x36, 0x37, 0xd5, 0x22, 0x62, 0x8f, 0x6b,
+      0xfa, 0xda, 0xb4, 0xa5, 0xa4, 0x30, 0xa5, 0x59, 0xbd, 0x08, 0x6e, 0xae, 0x83, 0xf7, 0x24, 0x6c,
+      0x8d, 0xf3, 0xc3, 0xd3, 0x39, 0x67, 0x89, 0x98, 0x66, 0x67, 0x43, 0x29, 0x12, 0xbf, 0x51, 0x6b,
+      0x7c, 0xb6, 0x6b, 0x27, 0xf4, 0xdd, 0x29, 0x34, 0x31, 0xad, 0x3c, 0x81, 0x7b, 0xfa, 0xd8, 0xdd,
+      0xae, 0xdd, 0x6e, 0x43, 0xe5, 0x1e, 0x99, 0x3c, 0x84, 0x2e, 0x2d, 0x01, 0xda, 0x69, 0xda, 0xec,
+      0xb1, 0xfa, 0x81, 0x30, 0x36, 0x05, 0x9c, 0x1a, 0x01, 0x2b, 0x5e, 0x6b, 0x27, 0x4e, 0xed, 0xd4,
+      0x31, 0xd8, 0xab, 0xd6, 0xc7, 0x76, 0xad, 0x6e, 0xd7, 0x8e, 0xd6, 0xac, 0x8f, 0x9c, 0x5a, 0xdd,
+      0x58, 0x1f, 0xef, 0x4e, 0x94, 0x79, 0x64, 0xef, 0xcf, 0x5a, 0x6c, 0x76, 0x90, 0x15, 0x3d, 0x17,
+      0xb4, 0x45, 0xf1, 0xd1, 0x04, 0xb9, 0xa6, 0x65, 0xa6, 0xe0, 0x32, 0x68, 0xd3, 0xce, 0x4a, 0xe7,
+      0x08, 0x42, 0xa5, 0x06, 0x36, 0x34, 0x8e, 0x8f, 0x3f, 0x92, 0x1a, 0xe3, 0x65, 0xaf, 0xb2, 0x15,
+      0x6a, 0x5b, 0xf3, 0x04, 0x9f, 0x44, 0x8a, 0x67, 0x8b, 0x86, 0x2d, 0x86, 0x43, 0x02, 0xfc, 0xa3,
+      0x93, 0x5a, 0x6d, 0x4d, 0xc7, 0x00, 0xf5, 0x93, 0x46, 0xf8, 0x9b, 0xa2, 0x7a, 0x12, 0xe3, 0x94,
+      0x62, 0x19, 0x73, 0x7a, 0x87, 0xbe, 0xa0, 0xa4, 0x33, 0xe2, 0x10, 0x7a, 0x42, 0x26, 0x2c, 0x7e,
+      0x22, 0x74, 0x23, 0xb6, 0x07, 0x59, 0x9e, 0x56, 0xef, 0x09, 0xf5, 0x75, 0x65, 0x3f, 0xbb, 0xd0,
+      0xff, 0xd3, 0xc3, 0x69, 0xe3, 0x7d, 0xb1, 0x0f, 0x44, 0x92, 0xa0, 0xfc, 0x3f, 0x62, 0x2f, 0x94,
+      0xed, 0x23, 0xf6, 0x58, 0x8c, 0x62, 0x9c, 0x62, 0x7c, 0x56, 0xfc, 0xfa, 0xa7, 0xbb, 0xc2, 0x5d,
+      0x8c, 0x29, 0xf6, 0x4a, 0xba, 0x24, 0x41, 0x65, 0xca, 0x19, 0xe4, 0xea, 0x61, 0x4f, 0x51, 0x6e,
+      0x69, 0x28, 0x99, 0x36, 0xf8, 0x68, 0xf3, 0xee, 0x06, 0xfd, 0x6f, 0x41, 0xaf, 0x75, 0x0f, 0x3e,
+      0xd4, 0x60, 0x0b, 0x3e, 0xbf, 0x0c, 0xfa, 0xd7, 0x04, 0xd5, 0x0f, 0xb7, 0xa0, 0x56, 0xbf, 0x73,
+      0xdd, 0x69, 0x9d, 0x5f, 0x12, 0xda, 0xd8, 0x46, 0x83, 0x7e, 0xff, 0xaa, 0x4f, 0xd0, 0xd1, 0x36,
+      0x74, 0x7b, 0xde, 0xef, 0x75, 0x7a, 0xdf, 0x08, 0xfc, 0xbc, 0x0d, 0xf6, 0xae, 0x88, 0x34, 0x20,
+      0xec, 0x78, 0x1b, 0xeb, 0xf4, 0xbe, 0x5e, 0x11, 0x72, 0xb2, 0x8d, 0xb4, 0x83, 0x2f, 0x37, 0x86,
+      0xf0, 0x74, 0x1f, 0xd3, 0xb7, 0x38, 0x7c, 0xce, 0x16, 0x0d, 0xff, 0x85, 0xd7, 0xd5, 0x1c, 0x71,
+      0x7c, 0x79, 0xe8, 0xf1, 0x94, 0xfa, 0x27, 0x79, 0x1a, 0x95, 0x47, 0xde, 0x07, 0xe6, 0x6c, 0xdb,
+      0xf1, 0xdd, 0xdd, 0x7e, 0x16, 0x24, 0x46, 0x67, 0x0f, 0x92, 0x8f, 0xc6, 0x3a, 0x25, 0xc9, 0x7e,
+      0xbd, 0xf1, 0xcb, 0xae, 0x70, 0x76, 0xef, 0xac, 0xc8, 0x87, 0x98, 0xaa, 0x9f, 0xda, 0x5c, 0x77,
+      0x48, 0xb8, 0xdb, 0x43, 0x64, 0x43, 0xf2, 0x3b, 0x5e, 0x0f, 0x24, 0x43, 0x1e, 0x8e, 0x51, 0xb2,
+      0x5c, 0x11, 0xa6, 0xe9, 0xfa, 0x51, 0xcc, 0x51, 0x64, 0xce, 0x28, 0x35, 0xc7, 0x3e, 0xa0, 0xbf,
+      0x74, 0xf4, 0x9a, 0x5c, 0xcf, 0xcd, 0xe3, 0xe2, 0x0a, 0x5e, 0xc2, 0x1b, 0x97, 0xf1, 0xa1, 0x10,
+      0x3a, 0x15, 0x7a, 0xe1, 0xa1, 0x12, 0x56, 0x61, 0xbd, 0xee, 0x38, 0x58, 0x21, 0xf6, 0xca, 0xca,
+      0xa8, 0x1c, 0xca, 0x87, 0x50, 0x99, 0xf1, 0x34, 0x12, 0x33, 0xa7, 0xb8, 0xf6, 0x0e, 0x44, 0x2e,
+      0x43, 0xac, 0xc2, 0x3f, 0x73, 0x05, 0x54, 0x93, 0x28, 0x0d, 0xaa, 0xe8, 0xa5, 0x57, 0x20, 0xc5,
+      0x19, 0xac, 0x8c, 0xab, 0xac, 0x5f, 0xa3, 0xab, 0xbf, 0xcd, 0xad, 0xca, 0xf1, 0x0e, 0x8b, 0xa2,
+      0x62, 0xf0, 0x25, 0x55, 0x05, 0x98, 0xa2, 0xac, 0x50, 0x11, 0x95, 0x64, 0x31, 0x5a, 0x87, 0x50,
+      0x41, 0x03, 0x54, 0xc1, 0x6f, 0x2e, 0x5d, 0x2d, 0x9d, 0x15, 0x63, 0xc8, 0xd9, 0xef, 0x83, 0xab,
+      0x9e, 0x93, 0x31, 0xa9, 0xb0, 0x1c, 0xed, 0x98, 0x4b, 0xc2, 0xd2, 0x07, 0x40, 0x24, 0xc2, 0x3c,
+      0x31, 0xfd, 0x23, 0xd4, 0x41, 0x8c, 0xa6, 0xf9, 0xe5, 0xb1, 0x13, 0x55, 0x9e, 0x0b, 0x8a, 0xaa,
+      0xa3, 0xf1, 0xbb, 0x6e, 0x95, 0x75, 0x15, 0x31, 0x96, 0xd4, 0x0e, 0x41, 0x8e, 0x16, 0x5f, 0xf9,
+      0x77, 0x8c, 0x2a, 0x8d, 0x37, 0x13, 0x2e, 0x4b, 0x8e, 0x17, 0x58, 0x17, 0xf8, 0x0e, 0xea, 0x1f,
+      0xf3, 0xd6, 0x8f, 0x62, 0x1e, 0x16, 0xf9, 0xf7, 0xdc, 0xb2, 0xde, 0x32, 0x05, 0x98, 0xa9, 0x7f,
+      0xff, 0x05, 0x8f, 0xe5, 0xfc, 0x92, 0x0f, 0x0f, 0x00, 0x00 };
+  const uint8_t WWW_PRESURE_CSS[] PROGMEM = {
+      0x2f, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x2f,
+      0x0a, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+      0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x37, 0x61, 0x62,
+      0x36, 0x65, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30,
+      0x30, 0x32, 0x39, 0x34, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d,
+      0x74, 0x6f, 0x70, 0x3a, 0x20, 0x34, 0x37, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72,
+      0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x34, 0x37, 0x70, 0x78,
+      0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a,
+      0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48, 0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63,
+      0x61, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x20,
+      0x20, 0x7a, 0x2d, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
+      0x6c, 0x69, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f,
+      0x70, 0x3a, 0x20, 0x30, 0x2e, 0x38, 0x65, 0x6d, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x61, 0x3a, 0x3a,
+      0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+      0x6e, 0x74, 0x3a, 0x20, 0x27, 0x5b, 0x20, 0x27, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x61, 0x3a, 0x3a,
+      0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+      0x74, 0x3a, 0x20, 0x27, 0x20, 0x5d, 0x27, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x61, 0x20, 0x7b, 0x0a,
+      0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x32, 0x39, 0x34, 0x64,
+      0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+      0x20, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65,
+      0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a,
+      0x7d, 0x0a, 0x0a, 0x61, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x62,
+      0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+      0x20, 0x23, 0x62, 0x36, 0x63, 0x65, 0x65, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+      0x72, 0x3a, 0x20, 0x23, 0x66, 0x31, 0x31, 0x61, 0x35, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x75,
+      0x6c, 0x2e, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+      0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x27, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72,
+      0x20, 0x4e, 0x65, 0x77, 0x27, 0x2c, 0x20, 0x43, 0x6f, 0x75, 0x72, 0x69, 0x65, 0x72, 0x2c, 0x20,
+      0x6d, 0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x64, 0x69,
+      0x76, 0x2e, 0x66, 0x6f, 0x6f, 0x74, 0x6e, 0x6f, 0x74, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x63,
+      0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 0x64, 0x34, 0x37, 0x34, 0x37, 0x3b, 0x0a, 0x20,
+      0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c,
+      0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66,
+      0x74, 0x3a, 0x20, 0x31, 0x35, 0x65, 0x6d, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x64, 0x69, 0x76, 0x2e,
+      0x63, 0x6f, 0x64, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d,
+      0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x2e, 0x31, 0x35, 0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x6d,
+      0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x30, 0x2e,
+      0x34, 0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20,
+      0x30, 0x2e, 0x35, 0x65, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+      0x23, 0x33, 0x62, 0x33, 0x62, 0x33, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+      0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x62,
+      0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+      0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+      0x2e, 0x31, 0x31, 0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64,
+      0x74, 0x68, 0x3a, 0x20, 0x33, 0x35, 0x65, 0x6d, 0x3b, 0x0a, 0x7d };
+  const uint8_t WWW_PRESURE_CSS_GZ[] PROGMEM = {
+      0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x75, 0x51, 0xcb, 0x4e, 0xc3, 0x30,
+      0x10, 0xbc, 0xe7, 0x2b, 0x56, 0xe2, 0x10, 0x40, 0x49, 0x9a, 0x94, 0xb4, 0x05, 0xf7, 0x84, 0xb8,
+      0x70, 0xe2, 0x07, 0x10, 0x07, 0x3b, 0xde, 0xa4, 0x16, 0x8e, 0xb7, 0x72, 0xdc, 0x27, 0xe2, 0xdf,
+      0xc9, 0xc3, 0x85, 0xbe, 0x48, 0x72, 0xb0, 0x67, 0x67, 0x77, 0x66, 0x27, 0xa3, 0xfb, 0xf6, 0x01,
+      0x41, 0x72, 0x07, 0xdd, 0x69, 0x14, 0xf4, 0xc7, 0xaf, 0x00, 0x40, 0xf0, 0xe2, 0xb3, 0xb2, 0xb4,
+      0x32, 0x32, 0x2e, 0x48, 0x93, 0x65, 0x70, 0x33, 0xe3, 0x62, 0x8a, 0x62, 0xde, 0x16, 0x0f, 0x48,
+      0x9a, 0x8e, 0x9f, 0x72, 0xd9, 0x21, 0x35, 0xb7, 0x95, 0x32, 0xb1, 0xa3, 0x25, 0x83, 0x7c, 0xb6,
+      0xdc, 0x1e, 0x61, 0x82, 0x9c, 0xa3, 0xfa, 0x0f, 0x2e, 0xc9, 0xb8, 0xb8, 0xe4, 0xb5, 0xd2, 0x3b,
+      0x06, 0xcf, 0x56, 0x71, 0x1d, 0xc1, 0x2b, 0xea, 0x35, 0x3a, 0x55, 0xf0, 0x08, 0x1a, 0x6e, 0x9a,
+      0xb8, 0x41, 0xab, 0xca, 0x8e, 0xbc, 0x8f, 0x95, 0x91, 0xb8, 0x65, 0x90, 0xce, 0x83, 0xef, 0x20,
+      0xd0, 0xaa, 0x37, 0x77, 0xac, 0x96, 0x26, 0x8f, 0x58, 0xf7, 0x45, 0xce, 0x98, 0xc0, 0x92, 0x2c,
+      0xf6, 0x9c, 0xa2, 0x95, 0x41, 0xe3, 0x18, 0x84, 0xef, 0x10, 0x1e, 0xea, 0xbc, 0x74, 0x68, 0xcf,
+      0xca, 0xf0, 0xe1, 0xcb, 0x1e, 0x3f, 0x5f, 0xad, 0xf7, 0xbb, 0x41, 0x55, 0x2d, 0x5a, 0xb6, 0x20,
+      0xdd, 0x83, 0x0e, 0xb7, 0x2e, 0x96, 0x58, 0x90, 0xe5, 0x4e, 0x91, 0x61, 0x60, 0xc8, 0xa0, 0x57,
+      0x59, 0xd0, 0xda, 0x8b, 0x5c, 0x09, 0x51, 0x4c, 0x0b, 0xc4, 0xf1, 0x71, 0x88, 0x65, 0x96, 0xf1,
+      0xc9, 0xd0, 0xbb, 0xd2, 0x89, 0x56, 0x8d, 0xeb, 0x7b, 0x4f, 0x62, 0x0a, 0x5f, 0x68, 0x65, 0x55,
+      0x3b, 0xf5, 0x0d, 0x37, 0x61, 0x04, 0xfe, 0x16, 0x41, 0x4d, 0x86, 0x9a, 0x25, 0x2f, 0x86, 0x76,
+      0xa9, 0xd6, 0x49, 0x49, 0xe4, 0x0c, 0x39, 0x3c, 0x59, 0x26, 0x97, 0xf9, 0x2c, 0x9f, 0xfd, 0x2e,
+      0xd3, 0xa8, 0x3d, 0x32, 0x68, 0x6a, 0xae, 0x75, 0x87, 0x2d, 0xb9, 0x94, 0xca, 0x54, 0xb1, 0xc6,
+      0xb2, 0xdd, 0x30, 0x9b, 0xf8, 0x38, 0xbb, 0x69, 0x05, 0x49, 0xbc, 0x92, 0xf8, 0xc0, 0xb9, 0xf8,
+      0xc3, 0x69, 0x92, 0x0f, 0xb8, 0x9f, 0xd8, 0x21, 0x9e, 0x79, 0x70, 0xf2, 0x20, 0xba, 0xf7, 0x3f,
+      0x27, 0x97, 0x79, 0xd9, 0x4a, 0xf0, 0xdb, 0x34, 0x02, 0xff, 0x25, 0x59, 0x36, 0xbe, 0x1b, 0x94,
+      0xb7, 0xf1, 0x46, 0x49, 0xb7, 0x60, 0xf0, 0x30, 0x18, 0xfe, 0x01, 0x1c, 0x1d, 0x93, 0xa1, 0xcb,
+      0x02, 0x00, 0x00 };
+  constexpr www_asset_t WWW_ASSETS[]{
+      { "/www/index.html", "b82bdff1e96133fb", WWW_INDEX_HTML, sizeof( WWW_INDEX_HTML ), WWW_INDEX_HTML_GZ, sizeof( WWW_INDEX_HTML_GZ ) },
+      { "/www/presure.css", "1dec05c7ba5ca4c6", WWW_PRESURE_CSS, sizeof( WWW_PRESURE_CSS ), WWW_PRESURE_CSS_GZ, sizeof( WWW_PRESURE_CSS_GZ ) } };
+  const char TMPL_INFO_HTML_0[] PROGMEM = R"rawliteral(<!DOCTYPE HTML>
+<html lang="de-DE">
+  <head>
+  <title>Server Information</title>
+  <meta name="description" content="water pressure monitor" />
+  <meta name="keywords" content="save presure values" />
+  <meta name="author" content="Dirk Marciniak" />
+  <meta name="viewport" content="width=device-width, initial-scale=1.0">
+  <link rel="stylesheet" href="presure.css">
+  </head>
+  <body>
+  <h1>Server Informationen</h1>
+  <h3>IDF Version: )rawliteral";
+  const char TMPL_INFO_HTML_2[] PROGMEM = R"rawliteral(</h3>
+  <h3>ESP Model: )rawliteral";
+  const char TMPL_INFO_HTML_4[] PROGMEM = R"rawliteral(</h3>
+  <h3>CORES: )rawliteral";
+  const char TMPL_INFO_HTML_6[] PROGMEM = R"rawliteral(</h3>
+  <br />
+  <br />
+  <div class="footnote">
+  (c) Dirk Marciniak
+  </div>
+  </body>
+</html>
+)rawliteral";
+  constexpr www_segment_t TMPL_INFO_HTML[]{
+      { TMPL_INFO_HTML_0, sizeof( TMPL_INFO_HTML_0 ) - 1, TmplVar::NONE },
+      { nullptr, 0, TmplVar::IDF_VERSION },
+      { TMPL_INFO_HTML_2, sizeof( TMPL_INFO_HTML_2 ) - 1, TmplVar::NONE },
+      { nullptr, 0, TmplVar::ESP_MODEL },
+      { TMPL_INFO_HTML_4, sizeof( TMPL_INFO_HTML_4 ) - 1, TmplVar::NONE },
+      { nullptr, 0, TmplVar::ESP_CORES },
+      { TMPL_INFO_HTML_6, sizeof( TMPL_INFO_HTML_6 ) - 1, TmplVar::NONE } };
+  const char TMPL_INTERVALL_HTML_0[] PROGMEM = R"rawliteral(<!DOCTYPE HTML>
+<html lang="de-DE">
+  <head>
+  <title>Messintervall</title>
+  <meta name="description" content="water pressure monitor" />
+  <meta name="keywords" content="save presure values" />
+  <meta name="author" content="Dirk Marciniak" />
+  <meta name="viewport" content="width=device-width, initial-scale=1.0">
+  <link rel="stylesheet" href="presure.css">
+  </head>
+  <body>
+  <h1>Intervall der Messungen</h1
+  <h3>)rawliteral";
+  const char TMPL_INTERVALL_HTML_2[] PROGMEM = R"rawliteral( Sekunden</h3>
+  <br />
+  <br />
+  <div class="footnote">
+  (c) Dirk Marciniak
+  </div>
+  </body>
+</html>
+)rawliteral";
+  constexpr www_segment_t TMPL_INTERVALL_HTML[]{
+      { TMPL_INTERVALL_HTML_0, sizeof( TMPL_INTERVALL_HTML_0 ) - 1, TmplVar::NONE },
+      { nullptr, 0, TmplVar::MEASURE_INTERVAL },
+      { TMPL_INTERVALL_HTML_2, sizeof( TMPL_INTERVALL_HTML_2 ) - 1, TmplVar::NONE } };
+  const char TMPL_VERSION_HTML_0[] PROGMEM = R"rawliteral(<!DOCTYPE HTML>
+<html lang="de-DE">
+  <head>
+  <title>Server Version</title>
+  <meta name="description" content="water pressure monitor" />
+  <meta name="keywords" content="save presure values" />
+  <meta name="author" content="Dirk Marciniak" />
+  <meta name="viewport" content="width=device-width, initial-scale=1.0">
+  <link rel="stylesheet" href="presure.css">
+  </head>
+  <body>
+  <h1>Interne Versionsnummer</h1>
+  <h3>Version: )rawliteral";
+  const char TMPL_VERSION_HTML_2[] PROGMEM = R"rawliteral(</h3>
+  <br />
+  <br />
+  <div class="footnote">
+  (c) Dirk Marciniak
+  </div>
+  </body>
+</html>
+)rawliteral";
+  constexpr www_segment_t TMPL_VERSION_HTML[]{
+      { TMPL_VERSION_HTML_0, sizeof( TMPL_VERSION_HTML_0 ) - 1, TmplVar::NONE },
+      { nullptr, 0, TmplVar::APP_VERSION },
+      { TMPL_VERSION_HTML_2, sizeof( TMPL_VERSION_HTML_2 ) - 1, TmplVar::NONE } };
+  constexpr www_template_t WWW_TEMPLATES[]{
+      { "/www/info.html", TMPL_INFO_HTML, sizeof( TMPL_INFO_HTML ) / sizeof( www_segment_t ) },
+      { "/www/intervall.html", TMPL_INTERVALL_HTML, sizeof( TMPL_INTERVALL_HTML ) / sizeof( www_segment_t ) },
+      { "/www/version.html", TMPL_VERSION_HTML, sizeof( TMPL_VERSION_HTML ) / sizeof( www_segment_t ) } };
+}  // namespace measure_h2o
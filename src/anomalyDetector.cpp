@@ -0,0 +1,184 @@
+#include "anomalyDetector.hpp"
+
+namespace measure_h2o
+{
+  AnomalyDetector::AnomalyDetector( const anomaly_params_t &_params )
+      : params( _params ), hasLast( false ), lastSec( 0 ), lastMbar( 0 ), pumpRising( false ), hour( 0 ), startsThisHour( 0 ),
+        startsLastHour( 0 ), pumpStarts( 0 ), segStart( 0 ), segLast( 0 ), segN( 0 ), segSt( 0 ), segSp( 0 ), segStt( 0 ), segStp( 0 ),
+        nightSlope( 0 ), windowCount( 0 ), windowDrop( 0 ), windowSec( 0 ), baselineQ4( 0 ), cusumQ4( 0 ), baselineValid( false )
+  {
+  }
+
+  /**
+   * one sample, returns the first anomaly found with this sample (value see AnomalyType)
+   */
+  AnomalyType AnomalyDetector::update( uint32_t _sec, int32_t _mbar, bool _night, int32_t &_value )
+  {
+    AnomalyType found{ AnomalyType::NONE };
+    int32_t value{ 0 };
+    _value = 0;
+    //
+    // pump starts are counted per clock hour
+    //
+    uint32_t nowHour = _sec / 3600;
+    if ( nowHour != hour )
+    {
+      startsLastHour = ( nowHour == hour + 1 ) ? startsThisHour : 0;
+      startsThisHour = 0;
+      hour = nowHour;
+    }
+    //
+    // first sample or a gap (reboot, sensor fault): no rate, a new night segment
+    //
+    if ( !hasLast || _sec <= lastSec || _sec - lastSec > params.maxGapS )
+    {
+      if ( segmentEnd( value ) )
+      {
+        found = AnomalyType::NIGHT_DECAY;
+        _value = value;
+      }
+      if ( _night )
+        segmentAdd( _sec, _mbar );
+      hasLast = true;
+      pumpRising = false;
+      windowCount = 0;
+      lastSec = _sec;
+      lastMbar = _mbar;
+      return found;
+    }
+    int32_t rise = _mbar - lastMbar;
+    uint32_t dt = _sec - lastSec;
+    // fall in mbar/min, Q4
+    int32_t rateQ4 = static_cast< int32_t >( ( static_cast< int64_t >( -rise ) * 16 * 60 ) / dt );
+    lastSec = _sec;
+    lastMbar = _mbar;
+    //
+    // pump: rising edge
+    //
+    bool rising = rise >= params.pumpEdgeMbar;
+    if ( rising && !pumpRising )
+    {
+      ++pumpStarts;
+      if ( ++startsThisHour == params.maxStartsHour + 1 )
+      {
+        found = AnomalyType::PUMP_CYCLING;
+        _value = static_cast< int32_t >( startsThisHour );
+      }
+    }
+    pumpRising = rising;
+    //
+    // quiet: no pump, no water drawn
+    //
+    int32_t drawQ4 = params.drawMbarMin * 16;
+    bool quiet = !rising && rateQ4 <= drawQ4 && rateQ4 >= -drawQ4;
+    //
+    // night segment ends with the night or with pump / draw
+    //
+    if ( !quiet || !_night )
+    {
+      if ( segmentEnd( value ) && found == AnomalyType::NONE )
+      {
+        found = AnomalyType::NIGHT_DECAY;
+        _value = value;
+      }
+    }
+    else
+    {
+      segmentAdd( _sec, _mbar );
+    }
+    //
+    // CUSUM of the quiet decay rate over a window; the baseline learns only if there is no suspicion
+    //
+    if ( !quiet )
+    {
+      windowCount = 0;
+      return found;
+    }
+    if ( windowCount == 0 )
+    {
+      windowDrop = 0;
+      windowSec = 0;
+    }
+    windowDrop -= rise;
+    windowSec += dt;
+    if ( ++windowCount < params.cusumWindow )
+      return found;
+    windowCount = 0;
+    int32_t windowQ4 = static_cast< int32_t >( ( static_cast< int64_t >( windowDrop ) * 16 * 60 ) / windowSec );
+    if ( !baselineValid )
+    {
+      baselineQ4 = windowQ4;
+      baselineValid = true;
+      return found;
+    }
+    cusumQ4 += windowQ4 - baselineQ4 - params.cusumKQ4;
+    if ( cusumQ4 < 0 )
+      cusumQ4 = 0;
+    if ( cusumQ4 > params.cusumHQ4 )
+    {
+      if ( found == AnomalyType::NONE )
+      {
+        found = AnomalyType::DECAY_SHIFT;
+        _value = ( windowQ4 - baselineQ4 + 8 ) / 16;
+      }
+      // the new rate is normal from now on, one event per change
+      cusumQ4 = 0;
+      baselineQ4 = windowQ4;
+    }
+    else if ( cusumQ4 == 0 )
+    {
+      baselineQ4 += ( windowQ4 - baselineQ4 ) / ( 1 << params.baselineShift );
+    }
+    return found;
+  }
+
+  const char *AnomalyDetector::getName( AnomalyType _type )
+  {
+    switch ( _type )
+    {
+      case AnomalyType::NONE:
+        return "none";
+      case AnomalyType::NIGHT_DECAY:
+        return "night-decay";
+      case AnomalyType::PUMP_CYCLING:
+        return "pump-cycling";
+      case AnomalyType::DECAY_SHIFT:
+        return "decay-shift";
+      default:
+        return "unknown";
+    }
+  }
+
+  /**
+   * least squares sums, time relative to the segment start
+   */
+  void AnomalyDetector::segmentAdd( uint32_t _sec, int32_t _mbar )
+  {
+    if ( segN == 0 )
+      segStart = _sec;
+    segLast = _sec;
+    int64_t t = static_cast< int64_t >( _sec - segStart );
+    ++segN;
+    segSt += t;
+    segSp += _mbar;
+    segStt += t * t;
+    segStp += t * _mbar;
+  }
+
+  /**
+   * slope of the segment in mbar/h, only if the segment is long enough
+   */
+  bool AnomalyDetector::segmentEnd( int32_t &_slope )
+  {
+    int64_t n = segN;
+    int64_t denom = n * segStt - segSt * segSt;
+    int64_t num = n * segStp - segSt * segSp;
+    bool longEnough = n >= 3 && segLast - segStart >= params.nightMinS;
+    segN = segSt = segSp = segStt = segStp = 0;
+    if ( !longEnough || denom <= 0 )
+      return false;
+    nightSlope = static_cast< int32_t >( ( num * 3600 ) / denom );
+    _slope = nightSlope;
+    return nightSlope < -params.nightDecayMbarH;
+  }
+}  // namespace measure_h2o
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include "statics.hpp"
+#include "anomalyMonitor.hpp"
+#include "timeKeeper.hpp"
+
+namespace measure_h2o
+{
+  const char *AnomalyMonitor::tag{ "AnomalyMonitor" };
+  portMUX_TYPE AnomalyMonitor::ringMux = portMUX_INITIALIZER_UNLOCKED;
+  AnomalyDetector AnomalyMonitor::detector{ anomaly_params_t{
+      prefs::PUMP_START_MBAR, prefs::ANOMALY_DRAW_MBAR_MIN, prefs::ANOMALY_MAX_GAP_S, prefs::ANOMALY_NIGHT_MIN_S,
+      prefs::ANOMALY_NIGHT_DECAY_MBAR_H, prefs::ANOMALY_MAX_STARTS_HOUR, prefs::ANOMALY_CUSUM_WINDOW, prefs::ANOMALY_CUSUM_K_Q4,
+      prefs::ANOMALY_CUSUM_H_Q4, prefs::ANOMALY_BASELINE_SHIFT } };
+  anomaly_event_t AnomalyMonitor::ring[ prefs::ANOMALY_RING_SIZE ];
+  uint32_t AnomalyMonitor::eventCount{ 0 };
+  volatile AnomalyType AnomalyMonitor::activeType{ AnomalyType::NONE };
+  volatile int64_t AnomalyMonitor::activeSince{ 0 };
+
+  /**
+   * a measure into the detector (measure task), events into the ring and to the log
+   */
+  void AnomalyMonitor::process( uint32_t _timestamp, int32_t _mbar )
+  {
+    struct tm ti;
+    TimeKeeper::toLocal( static_cast< time_t >( _timestamp ), ti );
+    bool night = ti.tm_hour >= prefs::ANOMALY_NIGHT_FROM_H && ti.tm_hour < prefs::ANOMALY_NIGHT_TO_H;
+    int32_t value{ 0 };
+    AnomalyType type = AnomalyMonitor::detector.update( _timestamp, _mbar, night, value );
+    if ( type == AnomalyType::NONE )
+      return;
+    anomaly_event_t event;
+    event.timestamp = _timestamp;
+    event.value = value;
+    event.type = type;
+    portENTER_CRITICAL( &AnomalyMonitor::ringMux );
+    AnomalyMonitor::ring[ AnomalyMonitor::eventCount % prefs::ANOMALY_RING_SIZE ] = event;
+    ++AnomalyMonitor::eventCount;
+    AnomalyMonitor::activeType = type;
+    AnomalyMonitor::activeSince = esp_timer_get_time();
+    portEXIT_CRITICAL( &AnomalyMonitor::ringMux );
+    elog.log( WARNING, "%s: anomaly <%s>, value <%d>", AnomalyMonitor::tag, AnomalyDetector::getName( type ), value );
+  }
+
+  /**
+   * event to show on LCD and LED, NONE if acknowledged or too old
+   */
+  AnomalyType AnomalyMonitor::getActive()
+  {
+    portENTER_CRITICAL( &AnomalyMonitor::ringMux );
+    AnomalyType type = AnomalyMonitor::activeType;
+    int64_t since = AnomalyMonitor::activeSince;
+    portEXIT_CRITICAL( &AnomalyMonitor::ringMux );
+    if ( type != AnomalyType::NONE && esp_timer_get_time() - since > prefs::ANOMALY_SHOW_YS )
+      return AnomalyType::NONE;
+    return type;
+  }
+
+  /**
+   * the event was seen (api)
+   */
+  void AnomalyMonitor::acknowledge()
+  {
+    AnomalyMonitor::activeType = AnomalyType::NONE;
+    elog.log( INFO, "%s: anomaly acknowledged", AnomalyMonitor::tag );
+  }
+
+  /**
+   * copy of an event, age 0 is the newest
+   */
+  bool AnomalyMonitor::getEvent( size_t _age, anomaly_event_t &_event )
+  {
+    bool found{ false };
+    portENTER_CRITICAL( &AnomalyMonitor::ringMux );
+    size_t count = std::min( static_cast< size_t >( AnomalyMonitor::eventCount ), prefs::ANOMALY_RING_SIZE );
+    if ( _age < count )
+    {
+      _event = AnomalyMonitor::ring[ ( AnomalyMonitor::eventCount - 1 - _age ) % prefs::ANOMALY_RING_SIZE ];
+      found = true;
+    }
+    portEXIT_CRITICAL( &AnomalyMonitor::ringMux );
+    return found;
+  }
+
+  /**
+   * events in the ring
+   */
+  size_t AnomalyMonitor::getEventCount()
+  {
+    portENTER_CRITICAL( &AnomalyMonitor::ringMux );
+    size_t count = std::min( static_cast< size_t >( AnomalyMonitor::eventCount ), prefs::ANOMALY_RING_SIZE );
+    portEXIT_CRITICAL( &AnomalyMonitor::ringMux );
+    return count;
+  }
+}  // namespace measure_h2o
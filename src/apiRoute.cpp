@@ -0,0 +1,50 @@
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include "apiRoute.hpp"
+
+namespace measure_h2o
+{
+  /**
+   * the first route with the path and a valid parameter
+   * if the path exists but no alternative fits, missing is the expected parameter
+   */
+  const api_route_t *ApiDispatch::match( const api_route_t *_routes, size_t _count, const char *_path, api_param_lookup_t _lookup,
+                                         void *_ctx, api_arg_t &_arg, const char *&_missing )
+  {
+    _missing = nullptr;
+    for ( size_t idx = 0; idx < _count; ++idx )
+    {
+      const api_route_t &route = _routes[ idx ];
+      if ( strcmp( route.path, _path ) != 0 )
+        continue;
+      const char *value = route.type == ApiParam::NONE ? nullptr : _lookup( _ctx, route.param );
+      if ( ( route.type == ApiParam::NONE || value ) && ApiDispatch::parseArg( route.type, value, _arg ) )
+      {
+        _missing = nullptr;
+        return &route;
+      }
+      // maybe an alternative with other parameter follows
+      _missing = route.param;
+    }
+    return nullptr;
+  }
+
+  /**
+   * value of the parameter into the argument, false if it doesn't fit the type
+   */
+  bool ApiDispatch::parseArg( ApiParam _type, const char *_value, api_arg_t &_arg )
+  {
+    _arg.text = _value;
+    _arg.number = 0;
+    if ( _type != ApiParam::NUMBER )
+      return true;
+    char *end{ nullptr };
+    errno = 0;
+    long number = strtol( _value, &end, 10 );
+    if ( end == _value || *end != 0 || errno == ERANGE || number < INT32_MIN || number > INT32_MAX )
+      return false;
+    _arg.number = static_cast< int32_t >( number );
+    return true;
+  }
+}  // namespace measure_h2o
@@ -1,7 +1,7 @@
 #include <limits>
-#include <cmath>
 #include "appStati.hpp"
 #include "statics.hpp"
+#include "tempComp.hpp"
 
 namespace prefs
 {
@@ -17,8 +17,14 @@ namespace prefs
   constexpr const char *CAL_MINVAL{ "cal_min" };
   constexpr const char *CAL_MAXVAL{ "cal_max" };
   constexpr const char *CAL_FACTOR{ "cal_factor" };
+  constexpr const char *CAL_FACTOR_Q16{ "cal_fact_q16" };
   constexpr const char *MEASURE_TIMEDIFF{ "measure_diff" };
   constexpr const char *SIGNAL_LED_BRIGHTNESS{ "led_brightness" };
+  constexpr const char *UPLOAD_URL{ "upload_url" };
+  constexpr const char *CAL_TABLE{ "cal_table" };
+  constexpr const char *TEMP_COEFF{ "temp_coeff" };
+  constexpr const char *ZERO_SHIFT{ "zero_shift" };
+  constexpr const char *AUTOZERO_ON{ "autozero" };
 
   //
   // init static variables
@@ -28,9 +34,10 @@ namespace prefs
   Preferences AppStati::lPref;
   uint32_t AppStati::calibreMinVal{ std::numeric_limits< uint32_t >::max() };
   uint32_t AppStati::calibreMaxVal{ std::numeric_limits< uint32_t >::max() };
-  double AppStati::calibreFactor{ -10.0 };
+  uint32_t AppStati::calibreFactorQ16{ 0 };
   uint32_t AppStati::currentMiliVolts{ 0 };
-  float AppStati::currentPressureBar{ 0.0F };
+  int32_t AppStati::currentPressureMbar{ 0 };
+  int16_t AppStati::currentTemperature{ TempComp::TEMP_UNKNOWN };
   volatile bool AppStati::presureWasChanged{ true };
   volatile bool AppStati::httpActive{ false };
   volatile bool AppStati::wasMeasure{ false };
@@ -59,7 +66,7 @@ namespace prefs
       AppStati::lPref.putLong( LOC_TIME_OFFSET, 0L );
       AppStati::lPref.putUInt( CAL_MINVAL, PRESSURE_MIN_MILIVOLT );
       AppStati::lPref.putUInt( CAL_MAXVAL, PRESSURE_MAX_MILIVOLT );
-      AppStati::lPref.putDouble( CAL_FACTOR, PRESSURE_CALIBR_VALUE );
+      AppStati::lPref.putUInt( CAL_FACTOR_Q16, PRESSURE_CALIBR_Q16 );
       AppStati::lPref.putUInt( MEASURE_TIMEDIFF, MEASURE_DIFF_TIME_S );
       AppStati::lPref.putUShort( SIGNAL_LED_BRIGHTNESS, LED_GLOBAL_BRIGHTNESS );
       Serial.println( "first-time-init preferences...DONE" );
@@ -99,7 +106,7 @@ namespace prefs
   {
     if ( AppStati::calibreMinVal == std::numeric_limits< uint32_t >::max() )
     {
-      AppStati::calibreMinVal = AppStati::lPref.getUInt( CAL_FACTOR, PRESSURE_MIN_MILIVOLT );
+      AppStati::calibreMinVal = AppStati::lPref.getUInt( CAL_MINVAL, PRESSURE_MIN_MILIVOLT );
     }
     return AppStati::calibreMinVal;
   }
@@ -117,15 +124,22 @@ namespace prefs
   }
 
   /**
-   * get the factor for compute the real preasure
+   * get the factor for compute the real preasure, mbar per mV as Q16.16
+   * (once from a double in older prefs)
    */
-  double AppStati::getCalibreFactor()
+  uint32_t AppStati::getCalibreFactorQ16()
   {
-    if ( AppStati::calibreFactor < 0.0F )
+    if ( AppStati::calibreFactorQ16 == 0 )
     {
-      AppStati::calibreFactor = AppStati::lPref.getDouble( CAL_FACTOR, PRESSURE_CALIBR_VALUE );
+      if ( !AppStati::lPref.isKey( CAL_FACTOR_Q16 ) && AppStati::lPref.isKey( CAL_FACTOR ) )
+      {
+        double factor = AppStati::lPref.getDouble( CAL_FACTOR, PRESSURE_CALIBR_VALUE );
+        AppStati::lPref.putUInt( CAL_FACTOR_Q16, static_cast< uint32_t >( factor * 65536.0 + 0.5 ) );
+        AppStati::lPref.remove( CAL_FACTOR );
+      }
+      AppStati::calibreFactorQ16 = AppStati::lPref.getUInt( CAL_FACTOR_Q16, PRESSURE_CALIBR_Q16 );
     }
-    return AppStati::calibreFactor;
+    return AppStati::calibreFactorQ16;
   }
 
   /**
@@ -147,12 +161,12 @@ namespace prefs
   }
 
   /**
-   *  set the compute factor for "real" preasure
+   *  set the compute factor for "real" preasure (mbar per mV, Q16.16)
    */
-  void AppStati::setCalibreFactor( double _val )
+  void AppStati::setCalibreFactorQ16( uint32_t _val )
   {
-    AppStati::lPref.putDouble( CAL_FACTOR, _val );
-    AppStati::calibreFactor = _val;
+    AppStati::lPref.putUInt( CAL_FACTOR_Q16, _val );
+    AppStati::calibreFactorQ16 = _val;
   }
 
   /**
@@ -168,18 +182,14 @@ namespace prefs
   }
 
   /**
-   * compute the real preasure
+   * set the real preasure, rounded to 0.01 bar
    */
-  void AppStati::setCurrentPressureBar( float _val )
-  {
-    //
-    // https://stackoverflow.com/questions/14369673/round-double-to-3-points-decimal
-    //  number 60, thanks!
-    //
-    float val = std::round( _val / 0.01 ) * 0.01;
-    if ( AppStati::currentPressureBar != val )
+  void AppStati::setCurrentPressureMbar( int32_t _val )
+  {
+    int32_t val = ( ( _val + 5 ) / 10 ) * 10;
+    if ( AppStati::currentPressureMbar != val )
     {
-      AppStati::currentPressureBar = val;
+      AppStati::currentPressureMbar = val;
       presureWasChanged = true;
     }
   }
@@ -264,4 +274,89 @@ namespace prefs
     return ( AppStati::lPref.putUInt( MEASURE_TIMEDIFF, _val ) > 0 );
   }
 
+  /**
+   * get the url of the collector for push uploads (empty == disabled)
+   */
+  String AppStati::getUploadUrl()
+  {
+    return ( AppStati::lPref.getString( UPLOAD_URL, "" ) );
+  }
+
+  /**
+   * set the url of the collector, an empty url disables uploads
+   */
+  bool AppStati::setUploadUrl( const String &_url )
+  {
+    if ( _url.isEmpty() )
+    {
+      AppStati::lPref.remove( UPLOAD_URL );
+      return true;
+    }
+    return ( AppStati::lPref.putString( UPLOAD_URL, _url.c_str() ) > 0 );
+  }
+
+  /**
+   * get the points of the calibration curve, returns the count (0 == no curve)
+   */
+  size_t AppStati::getCalibPoints( calib_point_t *_points )
+  {
+    size_t len = AppStati::lPref.getBytesLength( CAL_TABLE );
+    if ( len == 0 || len % sizeof( calib_point_t ) != 0 || len > CALIB_MAX_POINTS * sizeof( calib_point_t ) )
+      return 0;
+    return AppStati::lPref.getBytes( CAL_TABLE, _points, len ) / sizeof( calib_point_t );
+  }
+
+  /**
+   * save the points of the calibration curve, no points removes the curve
+   */
+  bool AppStati::setCalibPoints( const calib_point_t *_points, size_t _count )
+  {
+    if ( _count == 0 )
+    {
+      AppStati::lPref.remove( CAL_TABLE );
+      return true;
+    }
+    size_t len = _count * sizeof( calib_point_t );
+    return ( AppStati::lPref.putBytes( CAL_TABLE, _points, len ) == len );
+  }
+
+  /**
+   * learned temperature coefficient, 0 == not learned
+   */
+  int32_t AppStati::getTempCoefficient()
+  {
+    return AppStati::lPref.getInt( TEMP_COEFF, 0 );
+  }
+
+  bool AppStati::setTempCoefficient( int32_t _val )
+  {
+    return ( AppStati::lPref.putInt( TEMP_COEFF, _val ) > 0 );
+  }
+
+  /**
+   * tracked shift of the zero point (1/16 mV), 0 after calibration
+   */
+  int32_t AppStati::getZeroShiftQ4()
+  {
+    return AppStati::lPref.getInt( ZERO_SHIFT, 0 );
+  }
+
+  bool AppStati::setZeroShiftQ4( int32_t _val )
+  {
+    return ( AppStati::lPref.putInt( ZERO_SHIFT, _val ) > 0 );
+  }
+
+  /**
+   * auto zero is optional, default off
+   */
+  bool AppStati::getAutoZero()
+  {
+    return AppStati::lPref.getBool( AUTOZERO_ON, false );
+  }
+
+  bool AppStati::setAutoZero( bool _on )
+  {
+    return ( AppStati::lPref.putBool( AUTOZERO_ON, _on ) > 0 );
+  }
+
 }  // namespace prefs
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "autoZero.hpp"
+
+namespace measure_h2o
+{
+  AutoZero::AutoZero( const auto_zero_params_t &_params ) : params( _params ), count( 0 ), shiftQ4( 0 ), updates( 0 ), idle( false )
+  {
+  }
+
+  void AutoZero::setShiftQ4( int32_t _shiftQ4 )
+  {
+    int32_t limit = params.maxShiftMv * 16;
+    if ( _shiftQ4 > limit )
+      _shiftQ4 = limit;
+    else if ( _shiftQ4 < -limit )
+      _shiftQ4 = -limit;
+    shiftQ4 = _shiftQ4;
+  }
+
+  void AutoZero::reset()
+  {
+    count = 0;
+    shiftQ4 = 0;
+    idle = false;
+  }
+
+  /**
+   * a new measure; every full window is checked and then started new
+   */
+  bool AutoZero::update( uint32_t _miliVolts, uint32_t _zeroMv )
+  {
+    window[ count++ ] = static_cast< uint16_t >( _miliVolts > 0xffffU ? 0xffffU : _miliVolts );
+    if ( count < WINDOW )
+      return false;
+    count = 0;
+    uint32_t minMv = window[ 0 ];
+    uint32_t maxMv = window[ 0 ];
+    uint32_t sum{ 0 };
+    for ( size_t idx = 0; idx < WINDOW; ++idx )
+    {
+      minMv = window[ idx ] < minMv ? window[ idx ] : minMv;
+      maxMv = window[ idx ] > maxMv ? window[ idx ] : maxMv;
+      sum += window[ idx ];
+    }
+    // offset of the window from the calibrated zero point, 1/16 mV
+    int32_t offsetQ4 = static_cast< int32_t >( ( sum * 16 ) / WINDOW ) - static_cast< int32_t >( _zeroMv * 16 );
+    int32_t errorQ4 = offsetQ4 - shiftQ4;
+    int32_t nearQ4 = static_cast< int32_t >( params.nearMv * 16 );
+    idle = ( maxMv - minMv ) <= params.bandMv && errorQ4 <= nearQ4 && errorQ4 >= -nearQ4;
+    if ( !idle )
+      return false;
+    int32_t step = errorQ4 / ( 1 << params.gainShift );
+    if ( step > params.maxStepQ4 )
+      step = params.maxStepQ4;
+    else if ( step < -params.maxStepQ4 )
+      step = -params.maxStepQ4;
+    if ( step == 0 )
+      return false;
+    setShiftQ4( shiftQ4 + step );
+    ++updates;
+    return true;
+  }
+
+  /**
+   * millivolts as at the calibrated zero point
+   */
+  uint32_t AutoZero::apply( uint32_t _miliVolts ) const
+  {
+    int32_t miliVolts = static_cast< int32_t >( _miliVolts ) - ( shiftQ4 + 8 ) / 16;
+    return miliVolts < 0 ? 0 : static_cast< uint32_t >( miliVolts );
+  }
+}  // namespace measure_h2o
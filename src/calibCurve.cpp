@@ -0,0 +1,61 @@
+#include <limits>
+#include "calibCurve.hpp"
+
+namespace measure_h2o
+{
+  CalibCurve::CalibCurve() : knotMv{}, baseMbar{}, slopeQ16{}, pointCount( 0 )
+  {
+    build( nullptr, 0 );
+  }
+
+  /**
+   * segment idx from point idx to idx + 1, the first and the last are extrapolated
+   */
+  void CalibCurve::build( const calib_point_t *_points, size_t _count )
+  {
+    pointCount = _count < MAX_POINTS ? _count : MAX_POINTS;
+    for ( size_t idx = 0; idx < MAX_POINTS; ++idx )
+    {
+      if ( idx + 1 < pointCount )
+      {
+        const calib_point_t &from = _points[ idx ];
+        const calib_point_t &to = _points[ idx + 1 ];
+        knotMv[ idx ] = from.miliVolts;
+        baseMbar[ idx ] = from.mbar;
+        slopeQ16[ idx ] = static_cast< int32_t >( ( static_cast< int64_t >( to.mbar - from.mbar ) << 16 ) /
+                                                  ( to.miliVolts - from.miliVolts ) );
+      }
+      else
+      {
+        knotMv[ idx ] = std::numeric_limits< int32_t >::max();
+        baseMbar[ idx ] = 0;
+        slopeQ16[ idx ] = 0;
+      }
+    }
+  }
+
+  /**
+   * millivolts to millibar, below the first point with the first segment
+   */
+  int32_t CalibCurve::toMbar( int32_t _miliVolts ) const
+  {
+    // last segment with start <= mv, unused segments start at INT32_MAX
+    size_t idx{ 0 };
+    idx += static_cast< size_t >( _miliVolts >= knotMv[ idx + 4 ] ) * 4;
+    idx += static_cast< size_t >( _miliVolts >= knotMv[ idx + 2 ] ) * 2;
+    idx += static_cast< size_t >( _miliVolts >= knotMv[ idx + 1 ] );
+    int64_t delta = static_cast< int64_t >( _miliVolts ) - knotMv[ idx ];
+    return baseMbar[ idx ] + static_cast< int32_t >( ( delta * slopeQ16[ idx ] + 0x8000LL ) >> 16 );
+  }
+
+  /**
+   * first segment, extrapolated if the curve starts above 0 mbar
+   */
+  int32_t CalibCurve::getZeroMv() const
+  {
+    if ( !isCurve() || slopeQ16[ 0 ] <= 0 )
+      return -1;
+    int64_t zeroMv = knotMv[ 0 ] - ( static_cast< int64_t >( baseMbar[ 0 ] ) << 16 ) / slopeQ16[ 0 ];
+    return zeroMv < 0 ? -1 : static_cast< int32_t >( zeroMv );
+  }
+}  // namespace measure_h2o
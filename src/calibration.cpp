@@ -0,0 +1,158 @@
+#include <limits>
+#include "statics.hpp"
+#include "calibration.hpp"
+#include "appStati.hpp"
+
+namespace measure_h2o
+{
+  static_assert( prefs::CALIB_MAX_POINTS == CalibCurve::MAX_POINTS, "curve size differs from the prefs!" );
+
+  const char *Calibration::tag{ "Calibration" };
+  portMUX_TYPE Calibration::calMux = portMUX_INITIALIZER_UNLOCKED;
+  calib_point_t Calibration::points[ prefs::CALIB_MAX_POINTS ];
+  size_t Calibration::pointCount{ 0 };
+  CalibCurve Calibration::curve;
+
+  /**
+   * load the curve from NVS
+   */
+  void Calibration::init()
+  {
+    calib_point_t loaded[ prefs::CALIB_MAX_POINTS ];
+    size_t count = prefs::AppStati::getCalibPoints( loaded );
+    portENTER_CRITICAL( &Calibration::calMux );
+    for ( size_t idx = 0; idx < count; ++idx )
+      Calibration::points[ idx ] = loaded[ idx ];
+    Calibration::pointCount = count;
+    Calibration::curve.build( Calibration::points, count );
+    portEXIT_CRITICAL( &Calibration::calMux );
+    elog.log( INFO, "%s: <%d> calibration points, %s", Calibration::tag, count, count < 2 ? "linear" : "curve" );
+  }
+
+  /**
+   * millivolts to millibar, integer only
+   */
+  int32_t Calibration::toMbar( uint32_t _miliVolts )
+  {
+    int32_t mv = static_cast< int32_t >( _miliVolts );
+    int32_t mbar{ 0 };
+    bool curve{ false };
+
+    portENTER_CRITICAL( &Calibration::calMux );
+    if ( Calibration::curve.isCurve() )
+    {
+      mbar = Calibration::curve.toMbar( mv );
+      curve = true;
+    }
+    portEXIT_CRITICAL( &Calibration::calMux );
+    if ( curve )
+      return mbar;
+    //
+    // no curve: zero point and factor (reads NVS once, not in the lock)
+    //
+    int64_t diff = static_cast< int64_t >( mv ) - static_cast< int64_t >( prefs::AppStati::getCalibreMinVal() );
+    return static_cast< int32_t >( ( diff * prefs::AppStati::getCalibreFactorQ16() + 0x8000LL ) >> 16 );
+  }
+
+  /**
+   * millivolts at 0 mbar, the reference for the zero tracking
+   */
+  uint32_t Calibration::getZeroMv()
+  {
+    portENTER_CRITICAL( &Calibration::calMux );
+    int32_t zeroMv = Calibration::curve.getZeroMv();
+    portEXIT_CRITICAL( &Calibration::calMux );
+    if ( zeroMv < 0 )
+      return prefs::AppStati::getCalibreMinVal();
+    return static_cast< uint32_t >( zeroMv );
+  }
+
+  /**
+   * add a point to the curve; a point near by (millivolts) or with the same pressure is replaced
+   * the curve must rise (more millivolts, more pressure), else the point is rejected
+   */
+  bool Calibration::addPoint( uint32_t _miliVolts, int32_t _mbar )
+  {
+    if ( _miliVolts > std::numeric_limits< uint16_t >::max() || _mbar < 0 || _mbar > prefs::PRESSURE_MAX_MBAR )
+    {
+      elog.log( WARNING, "%s: point <%d mV, %d mbar> out of range", Calibration::tag, _miliVolts, _mbar );
+      return false;
+    }
+    calib_point_t curve[ prefs::CALIB_MAX_POINTS ];
+    size_t count = Calibration::getPoints( curve );
+    //
+    // remove replaced points
+    //
+    size_t kept{ 0 };
+    for ( size_t idx = 0; idx < count; ++idx )
+    {
+      uint32_t diff = curve[ idx ].miliVolts > _miliVolts ? curve[ idx ].miliVolts - _miliVolts : _miliVolts - curve[ idx ].miliVolts;
+      if ( diff >= prefs::CALIB_MIN_DIFF_MV && curve[ idx ].mbar != _mbar )
+        curve[ kept++ ] = curve[ idx ];
+    }
+    if ( kept >= prefs::CALIB_MAX_POINTS )
+    {
+      elog.log( WARNING, "%s: curve is full (%d points)", Calibration::tag, kept );
+      return false;
+    }
+    //
+    // insert sorted, check the curve rises
+    //
+    size_t pos = kept;
+    while ( pos > 0 && curve[ pos - 1 ].miliVolts > _miliVolts )
+    {
+      curve[ pos ] = curve[ pos - 1 ];
+      --pos;
+    }
+    curve[ pos ].miliVolts = static_cast< uint16_t >( _miliVolts );
+    curve[ pos ].mbar = static_cast< int16_t >( _mbar );
+    ++kept;
+    for ( size_t idx = 1; idx < kept; ++idx )
+    {
+      if ( curve[ idx ].mbar <= curve[ idx - 1 ].mbar )
+      {
+        elog.log( WARNING, "%s: point <%d mV, %d mbar> don't rise the curve, rejected", Calibration::tag, _miliVolts, _mbar );
+        return false;
+      }
+    }
+    if ( !prefs::AppStati::setCalibPoints( curve, kept ) )
+    {
+      elog.log( ERROR, "%s: can't save the curve!", Calibration::tag );
+      return false;
+    }
+    portENTER_CRITICAL( &Calibration::calMux );
+    for ( size_t idx = 0; idx < kept; ++idx )
+      Calibration::points[ idx ] = curve[ idx ];
+    Calibration::pointCount = kept;
+    Calibration::curve.build( Calibration::points, kept );
+    portEXIT_CRITICAL( &Calibration::calMux );
+    elog.log( INFO, "%s: point <%d mV, %d mbar> added, <%d> points", Calibration::tag, _miliVolts, _mbar, kept );
+    return true;
+  }
+
+  /**
+   * remove the curve, linear from zero point and factor again
+   */
+  void Calibration::clear()
+  {
+    prefs::AppStati::setCalibPoints( nullptr, 0 );
+    portENTER_CRITICAL( &Calibration::calMux );
+    Calibration::pointCount = 0;
+    Calibration::curve.build( nullptr, 0 );
+    portEXIT_CRITICAL( &Calibration::calMux );
+    elog.log( INFO, "%s: curve removed", Calibration::tag );
+  }
+
+  /**
+   * copy of the curve
+   */
+  size_t Calibration::getPoints( calib_point_t *_points )
+  {
+    portENTER_CRITICAL( &Calibration::calMux );
+    size_t count = Calibration::pointCount;
+    for ( size_t idx = 0; idx < count; ++idx )
+      _points[ idx ] = Calibration::points[ idx ];
+    portEXIT_CRITICAL( &Calibration::calMux );
+    return count;
+  }
+}  // namespace measure_h2o
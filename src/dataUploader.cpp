@@ -0,0 +1,335 @@
+#include <algorithm>
+#include <HTTPClient.h>
+#include "statics.hpp"
+#include "dataUploader.hpp"
+#include "appStati.hpp"
+#include "numFormat.hpp"
+#include "tempComp.hpp"
+
+namespace measure_h2o
+{
+  const char *DataUploader::tag{ "DataUploader" };
+  bool DataUploader::wasInit{ false };
+  TaskHandle_t DataUploader::taskHandle{ nullptr };
+  SemaphoreHandle_t DataUploader::queueSem{ nullptr };
+  presure_data_set_t DataUploader::queue{};
+  volatile size_t DataUploader::queueCount{ 0 };
+  int64_t DataUploader::backoff_ys{ prefs::UPLOAD_TASK_DELAY_YS };
+  uint32_t DataUploader::uploadedCount{ 0 };
+  uint32_t DataUploader::failedCount{ 0 };
+  uint32_t DataUploader::droppedCount{ 0 };
+  volatile bool DataUploader::flushWanted{ false };
+
+  //
+  // url of the collector, read once while init
+  //
+  static String uploadUrl;
+  static String uploadHost;
+
+  /**
+   * init this object (single)
+   */
+  void DataUploader::init()
+  {
+    elog.log( INFO, "%s: init push uploader...", DataUploader::tag );
+    if ( DataUploader::wasInit )
+      return;
+    uploadUrl = prefs::AppStati::getUploadUrl();
+    if ( uploadUrl.isEmpty() )
+    {
+      elog.log( INFO, "%s: no collector url, push uploads disabled.", DataUploader::tag );
+      return;
+    }
+    uploadHost = prefs::AppStati::getHostName();
+    DataUploader::queueSem = xSemaphoreCreateMutex();
+    DataUploader::queue.reserve( prefs::UPLOAD_MAX_BATCH );
+    DataUploader::wasInit = true;
+    DataUploader::start();
+    elog.log( INFO, "%s: init push uploader to <%s>...OK", DataUploader::tag, uploadUrl.c_str() );
+  }
+
+  /**
+   * internal: start upload task
+   */
+  void DataUploader::start()
+  {
+    elog.log( INFO, "%s: Task start...", DataUploader::tag );
+
+    if ( DataUploader::taskHandle )
+    {
+      vTaskDelete( DataUploader::taskHandle );
+      DataUploader::taskHandle = nullptr;
+    }
+    else
+    {
+      xTaskCreate( DataUploader::uTask, "u-task", configMINIMAL_STACK_SIZE * 8, nullptr, tskIDLE_PRIORITY, &DataUploader::taskHandle );
+    }
+  }
+
+  /**
+   * add a measure to the upload queue, if the queue is full the oldest is lost
+   */
+  void DataUploader::enqueue( const presure_data_t &_data )
+  {
+    if ( !DataUploader::wasInit )
+      return;
+    if ( xSemaphoreTake( DataUploader::queueSem, pdMS_TO_TICKS( 500 ) ) == pdTRUE )
+    {
+      if ( DataUploader::queue.size() >= prefs::UPLOAD_MAX_QUEUE )
+      {
+        DataUploader::queue.erase( DataUploader::queue.begin() );
+        ++DataUploader::droppedCount;
+      }
+      DataUploader::queue.push_back( _data );
+      DataUploader::queueCount = DataUploader::queue.size();
+      xSemaphoreGive( DataUploader::queueSem );
+    }
+    else
+    {
+      ++DataUploader::droppedCount;
+    }
+  }
+
+  /**
+   * count of records waiting in RAM, without the semaphore (other tasks change the queue)
+   */
+  size_t DataUploader::getQueueSize()
+  {
+    if ( !DataUploader::wasInit )
+      return 0;
+    return DataUploader::queueCount;
+  }
+
+  /**
+   * upload task, batches records and push them to the collector
+   */
+  void DataUploader::uTask( void * )
+  {
+    static int64_t nextTimeToUpload = prefs::UPLOAD_TASK_DELAY_YS;
+
+    while ( true )
+    {
+      int64_t nowTime = esp_timer_get_time();
+
+      if ( DataUploader::flushWanted )
+      {
+        //
+        // low memory (HeapMonitor), free the RAM of the queue
+        //
+        DataUploader::flushWanted = false;
+        if ( DataUploader::getQueueSize() > 0 )
+        {
+          elog.log( WARNING, "%s: low memory, spool <%d> records", DataUploader::tag, DataUploader::getQueueSize() );
+          DataUploader::spoolQueue( DataUploader::getQueueSize() );
+        }
+        if ( xSemaphoreTake( DataUploader::queueSem, pdMS_TO_TICKS( 1000 ) ) == pdTRUE )
+        {
+          DataUploader::queue.shrink_to_fit();
+          xSemaphoreGive( DataUploader::queueSem );
+        }
+      }
+
+      if ( nowTime > nextTimeToUpload )
+      {
+        bool success{ false };
+        WlanState state = prefs::AppStati::getWlanState();
+        if ( state == WlanState::CONNECTED || state == WlanState::TIMESYNCED )
+        {
+          //
+          // first the old data from spool, then the queue
+          // keeps the order of the records at the collector
+          //
+          success = true;
+          if ( SPIFFS.exists( prefs::UPLOAD_SPOOL_FILE ) )
+            success = DataUploader::uploadSpool( uploadUrl );
+          while ( success && DataUploader::getQueueSize() > 0 )
+            success = DataUploader::uploadQueue( uploadUrl );
+        }
+        if ( success )
+        {
+          DataUploader::backoff_ys = prefs::UPLOAD_TASK_DELAY_YS;
+        }
+        else
+        {
+          //
+          // collector or network not availible
+          // wait longer and longer, save RAM in the spool file
+          //
+          DataUploader::backoff_ys = std::min( DataUploader::backoff_ys << 1, prefs::UPLOAD_BACKOFF_MAX_YS );
+          if ( DataUploader::getQueueSize() >= prefs::UPLOAD_MAX_BATCH )
+            DataUploader::spoolQueue( DataUploader::getQueueSize() );
+          elog.log( WARNING, "%s: upload not possible, next try in <%d> sec...", DataUploader::tag,
+                    static_cast< int >( DataUploader::backoff_ys / 1000000LL ) );
+        }
+        nextTimeToUpload = nowTime + DataUploader::backoff_ys;
+      }
+      delay( 500 );
+    }
+  }
+
+  /**
+   * upload one batch from the queue, remove it from queue if success
+   */
+  bool DataUploader::uploadQueue( const String &_url )
+  {
+    presure_data_set_t batch;
+    char line[ 128 ];
+
+    if ( xSemaphoreTake( DataUploader::queueSem, pdMS_TO_TICKS( 1000 ) ) != pdTRUE )
+      return false;
+    size_t count = std::min( DataUploader::queue.size(), prefs::UPLOAD_MAX_BATCH );
+    batch.assign( DataUploader::queue.begin(), DataUploader::queue.begin() + count );
+    xSemaphoreGive( DataUploader::queueSem );
+    //
+    // make the body in line protocol
+    //
+    String body;
+    body.reserve( count * 80 );
+    for ( const presure_data_t &elem : batch )
+    {
+      if ( DataUploader::formatLine( line, sizeof( line ), elem ) > 0 )
+        body += line;
+    }
+    int code = DataUploader::post( _url, reinterpret_cast< uint8_t * >( const_cast< char * >( body.c_str() ) ), body.length() );
+    if ( code < 200 || code > 299 )
+    {
+      ++DataUploader::failedCount;
+      elog.log( WARNING, "%s: upload <%d> records failed, code <%d>", DataUploader::tag, count, code );
+      return false;
+    }
+    //
+    // only this task removes from the front, enqueue appends at the end
+    //
+    if ( xSemaphoreTake( DataUploader::queueSem, pdMS_TO_TICKS( 1000 ) ) == pdTRUE )
+    {
+      count = std::min( count, DataUploader::queue.size() );
+      DataUploader::queue.erase( DataUploader::queue.begin(), DataUploader::queue.begin() + count );
+      DataUploader::queueCount = DataUploader::queue.size();
+      xSemaphoreGive( DataUploader::queueSem );
+    }
+    DataUploader::uploadedCount += count;
+    elog.log( DEBUG, "%s: <%d> records uploaded", DataUploader::tag, count );
+    return true;
+  }
+
+  /**
+   * upload the spool file as one request, remove it if success
+   */
+  bool DataUploader::uploadSpool( const String &_url )
+  {
+    File fh = SPIFFS.open( prefs::UPLOAD_SPOOL_FILE, "r" );
+    if ( !fh )
+      return false;
+    size_t size = fh.size();
+    int code = DataUploader::post( _url, &fh, size );
+    fh.close();
+    if ( code < 200 || code > 299 )
+    {
+      ++DataUploader::failedCount;
+      elog.log( WARNING, "%s: upload spool (%d bytes) failed, code <%d>", DataUploader::tag, size, code );
+      return false;
+    }
+    SPIFFS.remove( prefs::UPLOAD_SPOOL_FILE );
+    elog.log( INFO, "%s: spool (%d bytes) uploaded", DataUploader::tag, size );
+    return true;
+  }
+
+  /**
+   * move records from the queue into the spool file
+   */
+  bool DataUploader::spoolQueue( size_t _count )
+  {
+    presure_data_set_t batch;
+    char line[ 128 ];
+
+    if ( xSemaphoreTake( DataUploader::queueSem, pdMS_TO_TICKS( 1000 ) ) != pdTRUE )
+      return false;
+    _count = std::min( _count, DataUploader::queue.size() );
+    batch.assign( DataUploader::queue.begin(), DataUploader::queue.begin() + _count );
+    DataUploader::queue.erase( DataUploader::queue.begin(), DataUploader::queue.begin() + _count );
+    DataUploader::queueCount = DataUploader::queue.size();
+    xSemaphoreGive( DataUploader::queueSem );
+
+    File fh = SPIFFS.open( prefs::UPLOAD_SPOOL_FILE, "a", true );
+    if ( !fh )
+    {
+      DataUploader::droppedCount += _count;
+      elog.log( ERROR, "%s: spool file can't open, <%d> records lost!", DataUploader::tag, _count );
+      return false;
+    }
+    size_t spooled{ 0 };
+    for ( const presure_data_t &elem : batch )
+    {
+      if ( fh.size() >= prefs::UPLOAD_MAX_SPOOL_SIZE )
+        break;
+      size_t len = DataUploader::formatLine( line, sizeof( line ), elem );
+      fh.write( reinterpret_cast< uint8_t * >( line ), len );
+      ++spooled;
+    }
+    fh.close();
+    if ( spooled < _count )
+    {
+      DataUploader::droppedCount += ( _count - spooled );
+      elog.log( ERROR, "%s: spool file full, <%d> records lost!", DataUploader::tag, _count - spooled );
+    }
+    elog.log( DEBUG, "%s: <%d> records spooled", DataUploader::tag, spooled );
+    return spooled == _count;
+  }
+
+  /**
+   * POST a buffer to the collector, returns the http code
+   */
+  int DataUploader::post( const String &_url, uint8_t *_payload, size_t _len )
+  {
+    HTTPClient http;
+    http.setTimeout( prefs::UPLOAD_HTTP_TIMEOUT_MS );
+    if ( !http.begin( _url ) )
+      return -1;
+    http.addHeader( "Content-Type", "text/plain; charset=utf-8" );
+    int code = http.sendRequest( "POST", _payload, _len );
+    http.end();
+    return code;
+  }
+
+  /**
+   * POST a stream (spool file) to the collector, returns the http code
+   */
+  int DataUploader::post( const String &_url, Stream *_stream, size_t _len )
+  {
+    HTTPClient http;
+    http.setTimeout( prefs::UPLOAD_HTTP_TIMEOUT_MS );
+    if ( !http.begin( _url ) )
+      return -1;
+    http.addHeader( "Content-Type", "text/plain; charset=utf-8" );
+    int code = http.sendRequest( "POST", _stream, _len );
+    http.end();
+    return code;
+  }
+
+  /**
+   * one record as influxdb line protocol, precision secounds
+   * water_pressure,host=esp_h2o-0000D42C bar=4.07,millivolts=2252i,temperature=31.25 1716812053
+   */
+  size_t DataUploader::formatLine( char *_buffer, size_t _size, const presure_data_t &_elem )
+  {
+    // numbers without printf, only strings are joined
+    char bar[ NumFormat::NUM_LEN ];
+    char miliVolts[ NumFormat::NUM_LEN ];
+    char stamp[ NumFormat::NUM_LEN ];
+    char temperature[ NumFormat::NUM_LEN + 13 ] = "";
+    NumFormat::fixed( bar, sizeof( bar ), _elem.pressureBar, 2 );
+    NumFormat::u32( miliVolts, sizeof( miliVolts ), _elem.miliVolts );
+    NumFormat::u32( stamp, sizeof( stamp ), _elem.timestamp );
+    if ( _elem.temperature != TempComp::TEMP_UNKNOWN )
+    {
+      strcpy( temperature, ",temperature=" );
+      NumFormat::scaled( temperature + 13, sizeof( temperature ) - 13, _elem.temperature, 2 );
+    }
+    int len = snprintf( _buffer, _size, "%s,host=%s bar=%s,millivolts=%si%s %s\n", prefs::UPLOAD_MEASUREMENT, uploadHost.c_str(), bar,
+                        miliVolts, temperature, stamp );
+    if ( len < 0 || static_cast< size_t >( len ) >= _size )
+      return 0;
+    return static_cast< size_t >( len );
+  }
+
+}  // namespace measure_h2o
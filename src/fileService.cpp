@@ -1,10 +1,13 @@
+#include <algorithm>
 #include <esp_spiffs.h>
-#include <regex>
 #include <cstdlib>
-#include <TimeLib.h>
 #include "statics.hpp"
 #include "fileService.hpp"
 #include "appStati.hpp"
+#include "rtcJournal.hpp"
+#include "timeKeeper.hpp"
+#include "numFormat.hpp"
+#include "tempComp.hpp"
 
 namespace measure_h2o
 {
@@ -31,6 +34,10 @@ namespace measure_h2o
     // init semaphore for access to datafiles
     //
     vSemaphoreCreateBinary( measureFileSem );
+    //
+    // measures not saved before the reset
+    //
+    RtcJournal::init( FileService::dataset );
     FileService::start();
   }
 
@@ -98,9 +105,10 @@ namespace measure_h2o
           FileService::computeAllFilesystemChecks();
         }
         //
-        // check if data have to save
+        // check if data have to save, records replayed from the journal
+        // wait for a valid clock (day file of the record)
         //
-        if ( !FileService::dataset.empty() )
+        if ( !FileService::dataset.empty() && TimeKeeper::isSynced() )
         {
           //
           // there are datas to store
@@ -160,8 +168,6 @@ namespace measure_h2o
     // find files in path prefs::DATA_PATH
     //
     File root = SPIFFS.open( String( prefs::DATA_PATH ).substring( 0, strlen( prefs::DATA_PATH ) - 1 ) );
-    std::regex reg( prefs::DAYLY_FILE_PATTERN );
-    std::smatch match;
     std::string fname( root.getNextFileName().c_str() );
     std::vector< String > fileList;
 
@@ -175,7 +181,7 @@ namespace measure_h2o
       //
       // is the Filename like my pattern
       //
-      if ( std::regex_search( fname, match, reg ) )
+      if ( FileService::isDayFileName( fname.c_str() ) )
       {
         //
         // filename matches
@@ -195,6 +201,7 @@ namespace measure_h2o
     // okay check files against current
     //
     int prefix = strlen( prefs::DATA_PATH );
+    String currentShort = FileService::getTodayFileName().substring( prefix, prefix + 10 );
     //
     // all filenames
     //
@@ -204,7 +211,6 @@ namespace measure_h2o
       // make from filename a dateTime
       //
       String nameShort = fileName.substring( prefix, prefix + 10 );
-      String currentShort = FileService::todayFileName.substring( prefix, prefix + 10 );
       if ( nameShort.compareTo( currentShort ) != 0 )
       {
         elog.log( INFO, "%s: file <%s> is too old, delete it!", FileService::tag, nameShort.c_str() );
@@ -268,7 +274,7 @@ namespace measure_h2o
   }
 
   /**
-   * save dataset(s) from queue to measure file
+   * save dataset(s) from queue to the day file of every record
    */
   int FileService::saveDatasets()
   {
@@ -277,49 +283,131 @@ namespace measure_h2o
     elog.log( DEBUG, "%s: there are <%d> datasets for store...", FileService::tag, FileService::dataset.size() );
     if ( xSemaphoreTake( FileService::measureFileSem, pdMS_TO_TICKS( 6000 ) ) == pdTRUE )
     {
-      char buffer[ 28 ];
-      FileService::getTodayFileName();
-      // open/create File mode append
-      auto fh = SPIFFS.open( FileService::todayFileName, "a", true );
-      if ( fh )
+      savedCount = static_cast< int >( FileService::writeDataset() );
+      // We have finished accessing the shared resource.  Release the
+      // semaphore.
+      xSemaphoreGive( FileService::measureFileSem );
+    }
+    return savedCount;
+  }
+
+  /**
+   * records with valid time directly into the day files, not through the journal
+   * (restamped offline measures, more than the journal holds); the set waiting for
+   * the file task is older (replayed from the journal) and is saved first, so the
+   * day files stay in time order; written records are removed from the set,
+   * returns the count saved (the rest for the next try)
+   */
+  size_t FileService::saveDirect( presure_data_set_t &_set )
+  {
+    size_t saved{ 0 };
+    if ( xSemaphoreTake( FileService::measureFileSem, pdMS_TO_TICKS( 6000 ) ) == pdTRUE )
+    {
+      FileService::writeDataset();
+      if ( FileService::dataset.empty() )
       {
-        elog.log( DEBUG, "%s: datafile <%s> opened...", FileService::tag, FileService::todayFileName.c_str() );
-        while ( FileService::dataset.size() > 0 )
-        {
-          //
-          // while all datasets are computed
-          // make a copy from first
-          //
-          presure_data_t elem = FileService::dataset.front();
-          // delete it from vector
-          FileService::dataset.erase( FileService::dataset.begin() );
-          //
-          fh.print( elem.timestamp );
-          fh.print( "," );
-          snprintf( buffer, 6, "%02.2f\0", elem.pressureBar );
-          fh.print( buffer );
-          fh.print( "," );
-          snprintf( buffer, 8, "%06d\0", elem.miliVolts );
-          fh.print( buffer );
-          fh.print( "\n" );
-          fh.flush();
-          ++savedCount;
-        }
-        elog.log( DEBUG, "%s: datafile <%s> <%d> lines written...", FileService::tag, FileService::todayFileName.c_str(), savedCount );
-        fh.close();
+        String fileName;
+        saved = FileService::writeDayFiles( _set, fileName );
+        if ( !_set.empty() )
+          elog.log( ERROR, "%s: datafile <%s> can't open, <%d> records wait", FileService::tag, fileName.c_str(), _set.size() );
       }
-      else
+      xSemaphoreGive( FileService::measureFileSem );
+    }
+    else
+    {
+      elog.log( ERROR, "%s: datafiles busy, <%d> records wait", FileService::tag, _set.size() );
+    }
+    return saved;
+  }
+
+  /**
+   * internal: the set into the day files, commit the journal; the caller holds measureFileSem
+   */
+  size_t FileService::writeDataset()
+  {
+    //
+    // the oldest records of the set may be dropped from the journal (ring overflow),
+    // only the records the journal still holds are committed
+    //
+    size_t pending = RtcJournal::getPendingCount();
+    size_t notInJournal = FileService::dataset.size() - std::min( FileService::dataset.size(), pending );
+    String fileName;
+    size_t saved = FileService::writeDayFiles( FileService::dataset, fileName );
+    elog.log( DEBUG, "%s: <%d> lines written...", FileService::tag, saved );
+    if ( saved > notInJournal )
+      RtcJournal::commit( saved - notInJournal );
+    notInJournal -= std::min( saved, notInJournal );
+    if ( !FileService::dataset.empty() )
+    {
+      //
+      // keep the measures for the next try, not more than the journal holds
+      // (the journal dropped the oldest itself, commit only what it still holds)
+      //
+      size_t lost{ 0 };
+      if ( FileService::dataset.size() > prefs::RTC_JOURNAL_SIZE )
       {
-        while ( !FileService::dataset.empty() )
-        {
-          FileService::dataset.erase( FileService::dataset.begin() );
-        }
-        elog.log( ERROR, "%s: datafile <%s> can't open, data lost!", FileService::tag, FileService::todayFileName.c_str() );
+        lost = FileService::dataset.size() - prefs::RTC_JOURNAL_SIZE;
+        FileService::dataset.erase( FileService::dataset.begin(), FileService::dataset.begin() + lost );
+        if ( lost > notInJournal )
+          RtcJournal::commit( lost - notInJournal );
       }
+      elog.log( ERROR, "%s: datafile <%s> can't open, <%d> records lost!", FileService::tag, fileName.c_str(), lost );
     }
-    // We have finished accessing the shared resource.  Release the
-    // semaphore.
-    xSemaphoreGive( FileService::measureFileSem );
+    return saved;
+  }
+
+  /**
+   * internal: the records of the set (oldest first) into the day file of every record,
+   * written records are removed; stops if a file can't open (its name in _fileName)
+   * the caller holds measureFileSem
+   */
+  size_t FileService::writeDayFiles( presure_data_set_t &_set, String &_fileName )
+  {
+    size_t savedCount{ 0 };
+    char line[ 64 ];
+    File fh;
+    while ( _set.size() > 0 )
+    {
+      //
+      // while all datasets are computed
+      // make a copy from first
+      //
+      presure_data_t elem = _set.front();
+      time_t stamp = static_cast< time_t >( elem.timestamp );
+      String dayFileName = FileService::getDayFileName( stamp );
+      if ( !fh || dayFileName != _fileName )
+      {
+        // first record or next day, open/create File mode append
+        if ( fh )
+          fh.close();
+        _fileName = dayFileName;
+        fh = SPIFFS.open( _fileName, "a", true );
+        if ( !fh )
+          break;
+        elog.log( DEBUG, "%s: datafile <%s> opened...", FileService::tag, _fileName.c_str() );
+      }
+      // delete it from vector
+      _set.erase( _set.begin() );
+      //
+      struct tm ti;
+      localtime_r( &stamp, &ti );
+      // "2024-05-27T14:20:53,4.07,002252,31.25" (temperature only if known)
+      size_t len = NumFormat::isoDateTime( line, sizeof( line ), ti );
+      line[ len++ ] = ',';
+      len += NumFormat::fixed( line + len, sizeof( line ) - len, elem.pressureBar, 2 );
+      line[ len++ ] = ',';
+      len += NumFormat::u32( line + len, sizeof( line ) - len, elem.miliVolts, 6 );
+      if ( elem.temperature != TempComp::TEMP_UNKNOWN )
+      {
+        line[ len++ ] = ',';
+        len += NumFormat::scaled( line + len, sizeof( line ) - len, elem.temperature, 2 );
+      }
+      line[ len++ ] = '\n';
+      fh.write( reinterpret_cast< const uint8_t * >( line ), len );
+      ++savedCount;
+    }
+    if ( fh )
+      fh.close();
     return savedCount;
   }
 
@@ -333,8 +421,6 @@ namespace measure_h2o
     // find files in path prefs::DATA_PATH
     //
     File root = SPIFFS.open( String( prefs::DATA_PATH ).substring( 0, strlen( prefs::DATA_PATH ) - 1 ) );
-    std::regex reg( prefs::DAYLY_FILE_PATTERN );
-    std::smatch match;
     std::string fname( root.getNextFileName().c_str() );
     std::vector< String > fileList;
 
@@ -348,7 +434,7 @@ namespace measure_h2o
       //
       // is the Filename like my pattern
       //
-      if ( std::regex_search( fname, match, reg ) )
+      if ( FileService::isDayFileName( fname.c_str() ) )
       {
         //
         // filename matches
@@ -368,13 +454,7 @@ namespace measure_h2o
     // find outdated files
     //
     int prefix = strlen( prefs::DATA_PATH );
-    tmElements_t currentTime;
-    currentTime.Hour = hour();
-    currentTime.Minute = minute();
-    currentTime.Second = second();
-    currentTime.Day = day();
-    currentTime.Month = month();
-    currentTime.Year = year() - 1970;  // because Year is offset from 1970
+    time_t currentTimeStamp = TimeKeeper::now();
     //
     // all filenames
     //
@@ -390,24 +470,20 @@ namespace measure_h2o
       time_t fDay = nameShort.substring( 8, 10 ).toInt();
       // elog.log( DEBUG, "%s: check file <%s> y: <%04d> m: <%02d> d: <%02d>", FileService::tag, nameShort.c_str(), fYear, fMonth, fDay
       // );
-      time_t nowTime = now();
-      tmElements_t fileTime;
-      fileTime.Hour = 0;
-      fileTime.Minute = 0;
-      fileTime.Second = 0;
-      fileTime.Day = fDay;
-      fileTime.Month = fMonth;
-      fileTime.Year = fYear - 1970;  // because Year is offset from 1970
+      struct tm fileTime = {};
+      fileTime.tm_mday = fDay;
+      fileTime.tm_mon = fMonth - 1;
+      fileTime.tm_year = fYear - 1900;
+      fileTime.tm_isdst = -1;
       //
       // change to secounds
       //
-      time_t fileTimeStamp = makeTime( fileTime );
-      time_t currentTimeStamp = makeTime( currentTime );
+      time_t fileTimeStamp = mktime( &fileTime );
       //
       // is the file older than max age?
-      // Test it if NTP works
+      // Test it if the clock was synced
       //
-      if ( prefs::AppStati::getWlanState() == WlanState::TIMESYNCED )
+      if ( TimeKeeper::isSynced() )
       {
         if ( std::abs( currentTimeStamp - fileTimeStamp ) > prefs::MAX_DATA_FILE_AGE_SEC )
         {
@@ -422,16 +498,124 @@ namespace measure_h2o
     return 0;
   }
 
+  /**
+   * local midnight of the day of a timestamp
+   */
+  time_t FileService::getDayStart( time_t _stamp )
+  {
+    struct tm ti;
+    localtime_r( &_stamp, &ti );
+    ti.tm_hour = 0;
+    ti.tm_min = 0;
+    ti.tm_sec = 0;
+    ti.tm_isdst = -1;
+    return mktime( &ti );
+  }
+
+  /**
+   * copy the records (lines) after <_day>/<_offset> from the day files into <_out>,
+   * over day boundaries until today, max <_maxBytes>, only complete lines
+   * day and offset are moved behind the last copied record, returns true if there is more data
+   */
+  bool FileService::readSince( time_t &_day, size_t &_offset, Print &_out, size_t _maxBytes )
+  {
+    uint8_t buffer[ 256 ];
+    size_t written{ 0 };
+    time_t today = FileService::getDayStart( TimeKeeper::now() );
+
+    if ( xSemaphoreTake( FileService::measureFileSem, pdMS_TO_TICKS( 1500 ) ) != pdTRUE )
+      return true;
+    while ( _day <= today )
+    {
+      String fileName = FileService::getDayFileName( _day );
+      File fh = SPIFFS.exists( fileName ) ? SPIFFS.open( fileName, "r" ) : File();
+      if ( fh )
+      {
+        size_t size = fh.size();
+        // file is new (e.g. deleted after interval change)
+        if ( _offset > size )
+          _offset = 0;
+        fh.seek( _offset );
+        while ( _offset < size )
+        {
+          size_t len = fh.read( buffer, std::min( sizeof( buffer ), size - _offset ) );
+          if ( len == 0 )
+            break;
+          if ( written + len > _maxBytes )
+          {
+            // limit reached, only complete lines
+            len = _maxBytes - written;
+            while ( len > 0 && buffer[ len - 1 ] != '\n' )
+              --len;
+            _out.write( buffer, len );
+            _offset += len;
+            fh.close();
+            xSemaphoreGive( FileService::measureFileSem );
+            return true;
+          }
+          _out.write( buffer, len );
+          written += len;
+          _offset += len;
+        }
+        fh.close();
+      }
+      if ( _day == today )
+        break;
+      // next day, +26 hours is safe over DST changes
+      _day = FileService::getDayStart( _day + 26 * 3600 );
+      _offset = 0;
+    }
+    xSemaphoreGive( FileService::measureFileSem );
+    return false;
+  }
+
+  /**
+   * is the path like "/data/YYYY-MM-DD-pressure.csv" (without regex)
+   */
+  bool FileService::isDayFileName( const char *_path )
+  {
+    size_t prefixLen = strlen( prefs::DATA_PATH );
+    if ( strncmp( _path, prefs::DATA_PATH, prefixLen ) != 0 )
+      return false;
+    const char *name = _path + prefixLen;
+    // "YYYY-MM-DD", dashes at 4 and 7
+    for ( int i = 0; i < 10; ++i )
+    {
+      bool isDash = ( i == 4 || i == 7 );
+      if ( isDash ? name[ i ] != '-' : !isdigit( static_cast< unsigned char >( name[ i ] ) ) )
+        return false;
+    }
+    return strcmp( name + 10, prefs::DAYLY_FILE_SUFFIX ) == 0;
+  }
+
+  /**
+   * get the filename for the (local) day of a timestamp
+   */
+  String FileService::getDayFileName( time_t _stamp )
+  {
+    char buffer[ 28 ];
+    struct tm ti;
+    localtime_r( &_stamp, &ti );
+    snprintf( buffer, 28, prefs::DAYLY_FILE_NAME, ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday );
+    String fileName( prefs::DATA_PATH );
+    fileName += String( buffer );
+    return fileName;
+  }
+
   /**
    * get the filename for today
    */
   String &FileService::getTodayFileName()
   {
-    if ( FileService::todayDay != day() )
+    struct tm ti;
+    TimeKeeper::toLocal( TimeKeeper::now(), ti );
+    // the whole date, the day of month alone repeats every month
+    int day = ( ti.tm_year + 1900 ) * 10000 + ( ti.tm_mon + 1 ) * 100 + ti.tm_mday;
+    if ( FileService::todayDay != day )
     {
       char buffer[ 28 ];
-      FileService::todayDay = day();
-      snprintf( buffer, 28, prefs::DAYLY_FILE_NAME, year(), month(), day() );
+      FileService::todayDay = day;
+      snprintf( buffer, 28, prefs::DAYLY_FILE_NAME, ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday );
       String fileName( prefs::DATA_PATH );
       fileName += String( buffer );
       FileService::todayFileName = fileName;
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <Esp.h>
+#include <esp_heap_caps.h>
+#include "statics.hpp"
+#include "heapMonitor.hpp"
+#include "dataUploader.hpp"
+
+namespace measure_h2o
+{
+  const char *HeapMonitor::tag{ "HeapMonitor" };
+  bool HeapMonitor::wasInit{ false };
+  TaskHandle_t HeapMonitor::taskHandle{ nullptr };
+  portMUX_TYPE HeapMonitor::ringMux = portMUX_INITIALIZER_UNLOCKED;
+  heap_sample_t HeapMonitor::ring[ prefs::HEAP_RING_SIZE ];
+  uint32_t HeapMonitor::sampleCount{ 0 };
+  volatile HeapLevel HeapMonitor::level{ HeapLevel::NORMAL };
+  uint32_t HeapMonitor::shedCount{ 0 };
+  uint32_t HeapMonitor::flushCount{ 0 };
+
+  /**
+   * init this object (single)
+   */
+  void HeapMonitor::init()
+  {
+    elog.log( INFO, "%s: init heap monitor...", HeapMonitor::tag );
+    if ( HeapMonitor::wasInit )
+      return;
+    HeapMonitor::wasInit = true;
+    HeapMonitor::sample();
+    HeapMonitor::start();
+    elog.log( INFO, "%s: init heap monitor...OK", HeapMonitor::tag );
+  }
+
+  /**
+   * internal: start monitor task
+   */
+  void HeapMonitor::start()
+  {
+    elog.log( INFO, "%s: Task start...", HeapMonitor::tag );
+
+    if ( HeapMonitor::taskHandle )
+    {
+      vTaskDelete( HeapMonitor::taskHandle );
+      HeapMonitor::taskHandle = nullptr;
+    }
+    else
+    {
+      xTaskCreate( HeapMonitor::hTask, "h-task", configMINIMAL_STACK_SIZE * 3, nullptr, tskIDLE_PRIORITY, &HeapMonitor::taskHandle );
+    }
+  }
+
+  /**
+   * monitor task, one sample per HEAP_SAMPLE_YS
+   */
+  void HeapMonitor::hTask( void * )
+  {
+    static int64_t nextTimeToSample = esp_timer_get_time() + prefs::HEAP_SAMPLE_YS;
+
+    while ( true )
+    {
+      int64_t nowTime = esp_timer_get_time();
+      if ( nowTime > nextTimeToSample )
+      {
+        HeapMonitor::sample();
+        nextTimeToSample = nowTime + prefs::HEAP_SAMPLE_YS;
+      }
+      delay( 1000 );
+    }
+  }
+
+  /**
+   * take a sample, put it into the ring and switch the level if needed
+   */
+  void HeapMonitor::sample()
+  {
+    multi_heap_info_t info;
+    heap_sample_t current;
+
+    heap_caps_get_info( &info, MALLOC_CAP_8BIT );
+    current.uptime = static_cast< uint32_t >( esp_timer_get_time() / 1000000LL );
+    current.free = static_cast< uint32_t >( info.total_free_bytes );
+    current.minFree = static_cast< uint32_t >( info.minimum_free_bytes );
+    current.maxBlock = static_cast< uint32_t >( info.largest_free_block );
+    current.fragPct = current.free > 0 ? static_cast< uint8_t >( 100U - ( current.maxBlock * 100ULL ) / current.free ) : 0;
+    HeapLevel oldLevel = HeapMonitor::level;
+    current.level = HeapMonitor::nextLevel( oldLevel, current.maxBlock );
+    portENTER_CRITICAL( &HeapMonitor::ringMux );
+    HeapMonitor::ring[ HeapMonitor::sampleCount % prefs::HEAP_RING_SIZE ] = current;
+    ++HeapMonitor::sampleCount;
+    HeapMonitor::level = current.level;
+    portEXIT_CRITICAL( &HeapMonitor::ringMux );
+    if ( current.level == oldLevel )
+      return;
+    //
+    // level changed, count and act
+    //
+    elog.log( current.level == HeapLevel::NORMAL ? INFO : WARNING, "%s: heap level %s -> %s (free %d, block %d, frag %d%%)",
+              HeapMonitor::tag, HeapMonitor::getLevelName( oldLevel ), HeapMonitor::getLevelName( current.level ), current.free,
+              current.maxBlock, current.fragPct );
+    if ( oldLevel == HeapLevel::NORMAL )
+      ++HeapMonitor::shedCount;
+    if ( current.level == HeapLevel::FLUSH )
+    {
+      ++HeapMonitor::flushCount;
+      DataUploader::requestFlush();
+    }
+  }
+
+  /**
+   * next level from the largest free block, back only with hysteresis
+   */
+  HeapLevel HeapMonitor::nextLevel( HeapLevel current, uint32_t maxBlock )
+  {
+    if ( maxBlock < prefs::HEAP_FLUSH_BLOCK )
+      return HeapLevel::FLUSH;
+    if ( maxBlock < prefs::HEAP_SHED_BLOCK )
+    {
+      // from FLUSH to SHED only with hysteresis
+      if ( current == HeapLevel::FLUSH && maxBlock < prefs::HEAP_FLUSH_BLOCK + prefs::HEAP_HYSTERESIS )
+        return HeapLevel::FLUSH;
+      return HeapLevel::SHED;
+    }
+    if ( current != HeapLevel::NORMAL && maxBlock < prefs::HEAP_SHED_BLOCK + prefs::HEAP_HYSTERESIS )
+      return HeapLevel::SHED;
+    return HeapLevel::NORMAL;
+  }
+
+  /**
+   * copy of a sample, age 0 is the newest, false if not in the ring
+   */
+  bool HeapMonitor::getSample( size_t _age, heap_sample_t &_sample )
+  {
+    bool found{ false };
+    portENTER_CRITICAL( &HeapMonitor::ringMux );
+    if ( _age < std::min( static_cast< size_t >( HeapMonitor::sampleCount ), prefs::HEAP_RING_SIZE ) )
+    {
+      _sample = HeapMonitor::ring[ ( HeapMonitor::sampleCount - 1 - _age ) % prefs::HEAP_RING_SIZE ];
+      found = true;
+    }
+    portEXIT_CRITICAL( &HeapMonitor::ringMux );
+    return found;
+  }
+
+  /**
+   * count of samples in the ring
+   */
+  size_t HeapMonitor::getSampleCount()
+  {
+    portENTER_CRITICAL( &HeapMonitor::ringMux );
+    size_t count = std::min( static_cast< size_t >( HeapMonitor::sampleCount ), prefs::HEAP_RING_SIZE );
+    portEXIT_CRITICAL( &HeapMonitor::ringMux );
+    return count;
+  }
+
+  /**
+   * name of the level for json and log
+   */
+  const char *HeapMonitor::getLevelName( HeapLevel _level )
+  {
+    switch ( _level )
+    {
+      case HeapLevel::SHED:
+        return "SHED";
+      case HeapLevel::FLUSH:
+        return "FLUSH";
+      case HeapLevel::NORMAL:
+      default:
+        return "NORMAL";
+    }
+  }
+}  // namespace measure_h2o
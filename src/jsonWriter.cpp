@@ -0,0 +1,152 @@
+#include "jsonWriter.hpp"
+#include "numFormat.hpp"
+
+namespace measure_h2o
+{
+  JsonWriter::JsonWriter( Print &_out ) : out( _out ), depth( 0 ), hasElems( 0 )
+  {
+  }
+
+  void JsonWriter::beginObject( const char *_key )
+  {
+    open( '{', _key );
+  }
+
+  void JsonWriter::endObject()
+  {
+    close( '}' );
+  }
+
+  void JsonWriter::beginArray( const char *_key )
+  {
+    open( '[', _key );
+  }
+
+  void JsonWriter::endArray()
+  {
+    close( ']' );
+  }
+
+  void JsonWriter::add( const char *_key, const char *_value )
+  {
+    next( _key );
+    if ( _value )
+      writeString( _value );
+    else
+      out.write( "null", 4 );
+  }
+
+  void JsonWriter::add( const char *_key, bool _value )
+  {
+    next( _key );
+    if ( _value )
+      out.write( "true", 4 );
+    else
+      out.write( "false", 5 );
+  }
+
+  void JsonWriter::add( const char *_key, int32_t _value )
+  {
+    char buffer[ NumFormat::NUM_LEN ];
+    next( _key );
+    out.write( buffer, NumFormat::i32( buffer, sizeof( buffer ), _value ) );
+  }
+
+  void JsonWriter::add( const char *_key, uint32_t _value )
+  {
+    char buffer[ NumFormat::NUM_LEN ];
+    next( _key );
+    out.write( buffer, NumFormat::u32( buffer, sizeof( buffer ), _value ) );
+  }
+
+  void JsonWriter::add( const char *_key, float _value, uint8_t _decimals )
+  {
+    char buffer[ NumFormat::NUM_LEN ];
+    next( _key );
+    // NaN, infinite or too large
+    size_t len = NumFormat::fixed( buffer, sizeof( buffer ), _value, _decimals );
+    if ( len == 0 )
+    {
+      out.write( "null", 4 );
+      return;
+    }
+    out.write( buffer, len );
+  }
+
+  /**
+   * comma if the level has elements, then the key (inside objects)
+   */
+  void JsonWriter::next( const char *_key )
+  {
+    uint16_t bit = static_cast< uint16_t >( 1U << depth );
+    if ( hasElems & bit )
+      out.write( ',' );
+    hasElems |= bit;
+    if ( _key )
+    {
+      writeString( _key );
+      out.write( ':' );
+    }
+  }
+
+  void JsonWriter::open( char _bracket, const char *_key )
+  {
+    next( _key );
+    out.write( _bracket );
+    if ( depth + 1 < MAX_DEPTH )
+      ++depth;
+    hasElems &= ~static_cast< uint16_t >( 1U << depth );
+  }
+
+  void JsonWriter::close( char _bracket )
+  {
+    hasElems &= ~static_cast< uint16_t >( 1U << depth );
+    if ( depth > 0 )
+      --depth;
+    out.write( _bracket );
+  }
+
+  /**
+   * write a string with quotes, escape control chars, quotes and backslash
+   */
+  void JsonWriter::writeString( const char *_str )
+  {
+    const char *start = _str;
+    out.write( '"' );
+    for ( const char *cp = _str; *cp; ++cp )
+    {
+      unsigned char ch = static_cast< unsigned char >( *cp );
+      if ( ch >= 0x20 && ch != '"' && ch != '\\' )
+        continue;
+      // flush the plain part, then the escape
+      out.write( start, cp - start );
+      start = cp + 1;
+      char esc[ 8 ];
+      switch ( ch )
+      {
+        case '"':
+          out.write( "\\\"", 2 );
+          break;
+        case '\\':
+          out.write( "\\\\", 2 );
+          break;
+        case '\n':
+          out.write( "\\n", 2 );
+          break;
+        case '\r':
+          out.write( "\\r", 2 );
+          break;
+        case '\t':
+          out.write( "\\t", 2 );
+          break;
+        default:
+          snprintf( esc, sizeof( esc ), "\\u%04x", ch );
+          out.write( esc, 6 );
+          break;
+      }
+    }
+    const char *end = start + strlen( start );
+    out.write( start, end - start );
+    out.write( '"' );
+  }
+}  // namespace measure_h2o
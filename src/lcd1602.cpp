@@ -1,6 +1,8 @@
+#include <cmath>
 #include "lcd1602.hpp"
 #include "appPrefs.hpp"
 #include "statics.hpp"
+#include "numFormat.hpp"
 
 namespace measure_h2o
 {
@@ -101,11 +103,15 @@ namespace measure_h2o
         printedPresureTitle = true;
         printedAlert = false;
         printedMessage = false;
+        // value was cleared with the title
+        lastPressure = NAN;
       }
       if ( lastPressure != _pressureBar )
       {
         char buffer[ 16 ];
-        snprintf( buffer, 5, "%1.2f", _pressureBar );
+        // 4 places on the display
+        if ( NumFormat::fixed( buffer, 5, _pressureBar, 2 ) == 0 )
+          strcpy( buffer, "----" );
         this->setCursor( 6, 1 );
         this->send_string( buffer );
         lastPressure = _pressureBar;
@@ -133,7 +139,8 @@ namespace measure_h2o
       {
         char buffer[ 16 ];
         this->setCursor( 6, 0 );
-        snprintf( buffer, 8, "%1.2f V", _tension );
+        size_t len = NumFormat::fixed( buffer, 5, _tension, 2 );
+        strcpy( buffer + len, " V" );
         this->send_string( buffer );
         lastTension = _tension;
       }
@@ -2,6 +2,7 @@
 #include "appStati.hpp"
 #include "ledStripe.hpp"
 #include "statics.hpp"
+#include "anomalyMonitor.hpp"
 
 namespace measure_h2o
 {
@@ -178,7 +179,11 @@ namespace measure_h2o
         // time to check if measure led have to clean
         //
         measureShow = false;
-        if ( wlState != TIMESYNCED )
+        if ( PrSensor::getHealthState() != SensorState::OK )
+          ledStripe.setPixelColor( prefs::LED_MEASURESTATE, prefs::LED_COLOR_SENSOR_FAULT );
+        else if ( AnomalyMonitor::getActive() != AnomalyType::NONE )
+          ledStripe.setPixelColor( prefs::LED_MEASURESTATE, prefs::LED_COLOR_ANOMALY );
+        else if ( wlState != TIMESYNCED )
           ledStripe.setPixelColor( prefs::LED_MEASURESTATE, prefs::LED_COLOR_MEASURE_INACTICE );
         else
           ledStripe.setPixelColor( prefs::LED_MEASURESTATE, prefs::LED_COLOR_BLACK );
@@ -0,0 +1,640 @@
+#include <algorithm>
+#include <cmath>
+#include <Esp.h>
+#include <SPIFFS.h>
+#include "statics.hpp"
+#include "liveStream.hpp"
+#include "fileService.hpp"
+#include "numFormat.hpp"
+#include "timeKeeper.hpp"
+#include "tempComp.hpp"
+
+namespace measure_h2o
+{
+  const char *LiveStream::tag{ "LiveStream" };
+  bool LiveStream::wasInit{ false };
+  TaskHandle_t LiveStream::taskHandle{ nullptr };
+  portMUX_TYPE LiveStream::ringMux = portMUX_INITIALIZER_UNLOCKED;
+  live_sample_t LiveStream::ring[ prefs::LIVE_RING_SIZE ];
+  volatile uint32_t LiveStream::writeSeq{ 1 };
+  uint32_t LiveStream::sentSeq{ 1 };
+  float LiveStream::filteredBar{ 0.0F };
+  SemaphoreHandle_t LiveStream::sourceSem{ nullptr };
+  AsyncEventSource *LiveStream::events{ nullptr };
+  AsyncEventSourceClient *LiveStream::sseClients[ prefs::LIVE_MAX_CLIENTS ]{};
+  AsyncWebSocket *LiveStream::ws{ nullptr };
+  portMUX_TYPE LiveStream::slotMux = portMUX_INITIALIZER_UNLOCKED;
+  ws_client_state_t LiveStream::wsClients[ prefs::WS_MAX_CLIENTS ]{};
+  uint32_t LiveStream::skippedCount{ 0 };
+
+  /**
+   * init this object (single)
+   */
+  void LiveStream::init()
+  {
+    elog.log( INFO, "%s: init live stream...", LiveStream::tag );
+    if ( LiveStream::wasInit )
+      return;
+    LiveStream::sourceSem = xSemaphoreCreateMutex();
+    LiveStream::wasInit = true;
+    LiveStream::start();
+  }
+
+  /**
+   * internal: start sender task
+   */
+  void LiveStream::start()
+  {
+    elog.log( INFO, "%s: Task start...", LiveStream::tag );
+
+    if ( LiveStream::taskHandle )
+    {
+      vTaskDelete( LiveStream::taskHandle );
+      LiveStream::taskHandle = nullptr;
+    }
+    else
+    {
+      xTaskCreate( LiveStream::eTask, "e-task", configMINIMAL_STACK_SIZE * 6, nullptr, tskIDLE_PRIORITY, &LiveStream::taskHandle );
+    }
+  }
+
+  /**
+   * a new sample from the measure task, store it in the fan-out ring
+   * never blocks the measure task for sending
+   */
+  void LiveStream::publish( const presure_data_t &_data )
+  {
+    if ( !LiveStream::wasInit )
+      return;
+    portENTER_CRITICAL( &LiveStream::ringMux );
+    if ( LiveStream::writeSeq == 1 )
+      LiveStream::filteredBar = _data.pressureBar;
+    else
+      LiveStream::filteredBar += prefs::LIVE_FILTER_ALPHA * ( _data.pressureBar - LiveStream::filteredBar );
+    live_sample_t &sample = LiveStream::ring[ LiveStream::writeSeq % prefs::LIVE_RING_SIZE ];
+    sample.seq = LiveStream::writeSeq;
+    sample.epoch = _data.timestamp;
+    sample.miliVolts = _data.miliVolts;
+    sample.pressureBar = _data.pressureBar;
+    sample.filteredBar = LiveStream::filteredBar;
+    sample.temperature = _data.temperature;
+    ++LiveStream::writeSeq;
+    portEXIT_CRITICAL( &LiveStream::ringMux );
+  }
+
+  /**
+   * create the event source and the websocket for the (new started) webserver
+   * the server owns the handlers and deletes them on server.reset()
+   */
+  void LiveStream::attach( AsyncWebServer &_server )
+  {
+    xSemaphoreTake( LiveStream::sourceSem, portMAX_DELAY );
+    LiveStream::events = new AsyncEventSource( prefs::LIVE_PATH );
+    LiveStream::events->onConnect( LiveStream::onConnect );
+    _server.addHandler( LiveStream::events );
+    LiveStream::ws = new AsyncWebSocket( prefs::WS_PATH );
+    LiveStream::ws->onEvent( LiveStream::onWsEvent );
+    _server.addHandler( LiveStream::ws );
+    xSemaphoreGive( LiveStream::sourceSem );
+  }
+
+  /**
+   * forget the handlers, call before server.reset()
+   */
+  void LiveStream::detach()
+  {
+    if ( !LiveStream::wasInit )
+      return;
+    xSemaphoreTake( LiveStream::sourceSem, portMAX_DELAY );
+    LiveStream::events = nullptr;
+    LiveStream::ws = nullptr;
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    for ( auto &slot : LiveStream::wsClients )
+      slot = ws_client_state_t{};
+    for ( auto &sse : LiveStream::sseClients )
+      sse = nullptr;
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    xSemaphoreGive( LiveStream::sourceSem );
+  }
+
+  /**
+   * count of subscribers
+   */
+  size_t LiveStream::getClientCount()
+  {
+    size_t count{ 0 };
+    if ( !LiveStream::wasInit )
+      return 0;
+    if ( xSemaphoreTake( LiveStream::sourceSem, pdMS_TO_TICKS( 100 ) ) == pdTRUE )
+    {
+      if ( LiveStream::events )
+        count = LiveStream::events->count();
+      xSemaphoreGive( LiveStream::sourceSem );
+    }
+    return count;
+  }
+
+  /**
+   * count of websocket clients
+   */
+  size_t LiveStream::getWsClientCount()
+  {
+    size_t count{ 0 };
+    if ( !LiveStream::wasInit )
+      return 0;
+    if ( xSemaphoreTake( LiveStream::sourceSem, pdMS_TO_TICKS( 100 ) ) == pdTRUE )
+    {
+      if ( LiveStream::ws )
+        count = LiveStream::ws->count();
+      xSemaphoreGive( LiveStream::sourceSem );
+    }
+    return count;
+  }
+
+  /**
+   * new subscriber, check the limit and replay the ring
+   * since the last event id the client has seen
+   */
+  void LiveStream::onConnect( AsyncEventSourceClient *client )
+  {
+    char buffer[ 128 ];
+    live_sample_t sample;
+    bool found{ false };
+
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    for ( auto &sse : LiveStream::sseClients )
+    {
+      if ( !sse )
+      {
+        sse = client;
+        found = true;
+        break;
+      }
+    }
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    if ( !found )
+    {
+      elog.log( WARNING, "%s: too many subscribers, reject client...", LiveStream::tag );
+      client->close();
+      return;
+    }
+    //
+    // the event source has no disconnect callback, take the one of the connection
+    // and do what the library does there (the client is deleted after it)
+    //
+    client->client()->onDisconnect( LiveStream::onSseDisconnect, client );
+    portENTER_CRITICAL( &LiveStream::ringMux );
+    uint32_t endSeq = LiveStream::writeSeq;
+    portEXIT_CRITICAL( &LiveStream::ringMux );
+    // no measure yet, nothing to replay (seq 0 is never written)
+    if ( endSeq == 1 )
+      return;
+    //
+    // new clients get the newest sample, reconnecting clients all they missed
+    //
+    uint32_t seq = client->lastId() + 1;
+    if ( client->lastId() == 0 || seq > endSeq )
+      seq = endSeq - 1;
+    if ( endSeq - seq > prefs::LIVE_RING_SIZE )
+      seq = endSeq - prefs::LIVE_RING_SIZE;
+    elog.log( DEBUG, "%s: new subscriber, replay from <%d>...", LiveStream::tag, seq );
+    for ( ; seq < endSeq; ++seq )
+    {
+      if ( LiveStream::getSample( seq, sample ) && LiveStream::formatSample( buffer, sizeof( buffer ), sample ) > 0 )
+        client->send( buffer, "sample", sample.seq );
+    }
+  }
+
+  /**
+   * connection of a subscriber closed, forget it before the library deletes it
+   */
+  void LiveStream::onSseDisconnect( void *arg, AsyncClient *tcp )
+  {
+    AsyncEventSourceClient *client = static_cast< AsyncEventSourceClient * >( arg );
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    for ( auto &sse : LiveStream::sseClients )
+    {
+      if ( sse == client )
+        sse = nullptr;
+    }
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    client->_onDisconnect();
+    delete tcp;
+  }
+
+  /**
+   * websocket events, runs in the async tcp task, so only short work here
+   * the history is read from the sender task
+   */
+  void LiveStream::onWsEvent( AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data,
+                              size_t len )
+  {
+    switch ( type )
+    {
+      case WS_EVT_CONNECT:
+      {
+        bool found{ false };
+        if ( server->count() <= prefs::WS_MAX_CLIENTS )
+        {
+          portENTER_CRITICAL( &LiveStream::slotMux );
+          for ( auto &slot : LiveStream::wsClients )
+          {
+            if ( slot.clientId == 0 )
+            {
+              slot = ws_client_state_t{};
+              slot.clientId = client->id();
+              found = true;
+              break;
+            }
+          }
+          portEXIT_CRITICAL( &LiveStream::slotMux );
+        }
+        if ( !found )
+        {
+          elog.log( WARNING, "%s: too many websocket clients, reject client...", LiveStream::tag );
+          client->close( 1013, "too many clients" );
+          return;
+        }
+        char buffer[ 96 ];
+        snprintf( buffer, sizeof( buffer ), "{\"record\":%u,\"version\":%u,\"layout\":\"u32 time,f32 bar,u32 mv,i16 centi_c,u16 0\"}",
+                  static_cast< unsigned >( sizeof( presure_data_t ) ), static_cast< unsigned >( RECORD_VERSION ) );
+        client->text( buffer );
+        elog.log( DEBUG, "%s: websocket client <%d> connected", LiveStream::tag, client->id() );
+        break;
+      }
+      case WS_EVT_DISCONNECT:
+        portENTER_CRITICAL( &LiveStream::slotMux );
+        for ( auto &slot : LiveStream::wsClients )
+        {
+          if ( slot.clientId == client->id() )
+            slot = ws_client_state_t{};
+        }
+        portEXIT_CRITICAL( &LiveStream::slotMux );
+        elog.log( DEBUG, "%s: websocket client <%d> disconnected", LiveStream::tag, client->id() );
+        break;
+      case WS_EVT_DATA:
+      {
+        //
+        // only short text commands in a single frame
+        //
+        AwsFrameInfo *info = reinterpret_cast< AwsFrameInfo * >( arg );
+        if ( info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT && len < 48 )
+        {
+          char cmd[ 48 ];
+          memcpy( cmd, data, len );
+          cmd[ len ] = 0;
+          LiveStream::onWsCommand( client, cmd );
+        }
+        else
+        {
+          client->text( "ERROR command too long" );
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  /**
+   * commands from websocket client
+   * "live on" / "live off"        : stream new samples
+   * "history <from> <to>"         : send records between from and to (UTC secounds)
+   */
+  void LiveStream::onWsCommand( AsyncWebSocketClient *client, const char *cmd )
+  {
+    unsigned from{ 0 }, to{ 0 };
+    bool live{ false };
+    bool history{ false };
+
+    if ( strcmp( cmd, "live on" ) == 0 )
+      live = true;
+    else if ( strcmp( cmd, "live off" ) == 0 )
+      live = false;
+    else if ( sscanf( cmd, "history %u %u", &from, &to ) == 2 && from <= to )
+      history = true;
+    else
+    {
+      client->text( "ERROR unknown command" );
+      return;
+    }
+    if ( history )
+    {
+      //
+      // only the time the day files can hold, older files are deleted
+      //
+      time_t now = TimeKeeper::now();
+      if ( now == 0 )
+      {
+        client->text( "ERROR time not synced" );
+        return;
+      }
+      time_t oldest = now - prefs::MAX_DATA_FILE_AGE_SEC - 24L * 60L * 60L;
+      from = std::max( from, static_cast< unsigned >( oldest ) );
+      to = std::min( to, static_cast< unsigned >( now ) );
+    }
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    for ( auto &slot : LiveStream::wsClients )
+    {
+      if ( slot.clientId != client->id() )
+        continue;
+      if ( history )
+      {
+        slot.history = true;
+        slot.from = from;
+        slot.to = to;
+        slot.day = 0;
+        slot.filePos = 0;
+      }
+      else
+      {
+        slot.live = live;
+      }
+    }
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    client->text( "OK" );
+  }
+
+  /**
+   * sender task, fan-out new samples to all subscribers
+   * and send running history requests chunk by chunk
+   */
+  void LiveStream::eTask( void * )
+  {
+    live_sample_t sample;
+
+    while ( true )
+    {
+      if ( xSemaphoreTake( LiveStream::sourceSem, pdMS_TO_TICKS( 100 ) ) == pdTRUE )
+      {
+        while ( LiveStream::sentSeq != LiveStream::writeSeq )
+        {
+          if ( LiveStream::getSample( LiveStream::sentSeq, sample ) )
+          {
+            LiveStream::sendEvent( sample );
+            LiveStream::sendWsLive( sample );
+          }
+          ++LiveStream::sentSeq;
+        }
+        if ( LiveStream::ws )
+        {
+          LiveStream::sendWsHistory();
+          LiveStream::ws->cleanupClients( prefs::WS_MAX_CLIENTS );
+        }
+        xSemaphoreGive( LiveStream::sourceSem );
+      }
+      delay( 250 );
+    }
+  }
+
+  /**
+   * send a sample to the SSE subscribers
+   * the library queues max 32 messages per client, if a client is
+   * slow (or the heap is low) samples are skipped for this client, never queued more
+   */
+  void LiveStream::sendEvent( const live_sample_t &_sample )
+  {
+    char buffer[ 128 ];
+    AsyncEventSourceClient *clients[ prefs::LIVE_MAX_CLIENTS ];
+
+    if ( !LiveStream::events || LiveStream::events->count() == 0 )
+      return;
+    if ( LiveStream::formatSample( buffer, sizeof( buffer ), _sample ) == 0 )
+      return;
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    memcpy( clients, LiveStream::sseClients, sizeof( clients ) );
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    for ( AsyncEventSourceClient *client : clients )
+    {
+      if ( !client || !client->connected() )
+        continue;
+      if ( ESP.getMaxAllocHeap() < prefs::LIVE_MIN_FREE_BLOCK || client->packetsWaiting() >= prefs::LIVE_MAX_PACKETS_WAITING )
+      {
+        ++LiveStream::skippedCount;
+        continue;
+      }
+      client->send( buffer, "sample", _sample.seq );
+    }
+  }
+
+  /**
+   * send a sample as binary record to websocket clients in live mode
+   */
+  void LiveStream::sendWsLive( const live_sample_t &_sample )
+  {
+    ws_client_state_t slots[ prefs::WS_MAX_CLIENTS ];
+    uint8_t frame[ sizeof( ws_frame_header_t ) + sizeof( presure_data_t ) ];
+
+    if ( !LiveStream::ws || LiveStream::ws->count() == 0 )
+      return;
+    ws_frame_header_t header{ WS_FRAME_LIVE, RECORD_VERSION, 1 };
+    presure_data_t record{ _sample.epoch, _sample.pressureBar, _sample.miliVolts, _sample.temperature, 0 };
+    memcpy( frame, &header, sizeof( header ) );
+    memcpy( frame + sizeof( header ), &record, sizeof( record ) );
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    memcpy( slots, LiveStream::wsClients, sizeof( slots ) );
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    for ( const auto &slot : slots )
+    {
+      if ( slot.clientId == 0 || !slot.live )
+        continue;
+      AsyncWebSocketClient *client = LiveStream::ws->client( slot.clientId );
+      if ( !client || client->status() != WS_CONNECTED )
+        continue;
+      if ( ESP.getMaxAllocHeap() < prefs::LIVE_MIN_FREE_BLOCK || client->queueLen() >= prefs::WS_MAX_QUEUED )
+      {
+        ++LiveStream::skippedCount;
+        continue;
+      }
+      client->binary( frame, sizeof( frame ) );
+    }
+  }
+
+  /**
+   * send the next chunk of running history requests
+   * a client with a full send queue has to wait for the next round
+   */
+  void LiveStream::sendWsHistory()
+  {
+    static uint8_t frame[ sizeof( ws_frame_header_t ) + prefs::WS_HISTORY_CHUNK * sizeof( presure_data_t ) ];
+    ws_client_state_t slots[ prefs::WS_MAX_CLIENTS ];
+
+    portENTER_CRITICAL( &LiveStream::slotMux );
+    memcpy( slots, LiveStream::wsClients, sizeof( slots ) );
+    portEXIT_CRITICAL( &LiveStream::slotMux );
+    for ( auto &slot : slots )
+    {
+      if ( slot.clientId == 0 || !slot.history )
+        continue;
+      AsyncWebSocketClient *client = LiveStream::ws->client( slot.clientId );
+      if ( !client || client->status() != WS_CONNECTED || client->queueLen() >= prefs::WS_MAX_QUEUED ||
+           ESP.getMaxAllocHeap() < prefs::LIVE_MIN_FREE_BLOCK )
+        continue;
+      uint16_t count{ 0 };
+      bool finished = LiveStream::readHistoryChunk( slot, frame + sizeof( ws_frame_header_t ), count );
+      if ( count > 0 )
+      {
+        ws_frame_header_t header{ WS_FRAME_HISTORY, RECORD_VERSION, count };
+        memcpy( frame, &header, sizeof( header ) );
+        client->binary( frame, sizeof( header ) + count * sizeof( presure_data_t ) );
+      }
+      if ( finished )
+      {
+        ws_frame_header_t header{ WS_FRAME_HISTORY_END, RECORD_VERSION, 0 };
+        client->binary( reinterpret_cast< uint8_t * >( &header ), sizeof( header ) );
+        slot.history = false;
+      }
+      //
+      // write back the progress, if the client is still the same
+      //
+      portENTER_CRITICAL( &LiveStream::slotMux );
+      for ( auto &dest : LiveStream::wsClients )
+      {
+        if ( dest.clientId == slot.clientId && dest.from == slot.from && dest.to == slot.to )
+        {
+          dest.history = slot.history;
+          dest.day = slot.day;
+          dest.filePos = slot.filePos;
+        }
+      }
+      portEXIT_CRITICAL( &LiveStream::slotMux );
+    }
+  }
+
+  /**
+   * read up to WS_HISTORY_CHUNK records from max WS_HISTORY_DAYS day files for a history request
+   * returns true if the request is complete
+   */
+  bool LiveStream::readHistoryChunk( ws_client_state_t &_slot, uint8_t *_dest, uint16_t &_count )
+  {
+    char line[ 64 ];
+    presure_data_t record;
+    struct tm ti;
+    size_t days{ 0 };
+
+    //
+    // local midnight of the last day
+    //
+    time_t lastDay = FileService::getDayStart( static_cast< time_t >( _slot.to ) );
+    if ( _slot.day == 0 )
+    {
+      _slot.day = FileService::getDayStart( static_cast< time_t >( _slot.from ) );
+      _slot.filePos = 0;
+    }
+    _count = 0;
+    while ( _slot.day <= lastDay )
+    {
+      String fileName = FileService::getDayFileName( _slot.day );
+      if ( SPIFFS.exists( fileName ) )
+      {
+        if ( xSemaphoreTake( FileService::measureFileSem, pdMS_TO_TICKS( 100 ) ) != pdTRUE )
+          return false;
+        File fh = SPIFFS.open( fileName, "r" );
+        bool eof{ true };
+        if ( fh )
+        {
+          fh.seek( _slot.filePos );
+          while ( _count < prefs::WS_HISTORY_CHUNK && fh.available() )
+          {
+            size_t len = fh.readBytesUntil( '\n', line, sizeof( line ) - 1 );
+            line[ len ] = 0;
+            if ( LiveStream::parseDataLine( line, record ) && record.timestamp >= _slot.from && record.timestamp <= _slot.to )
+            {
+              memcpy( _dest + _count * sizeof( presure_data_t ), &record, sizeof( record ) );
+              ++_count;
+            }
+          }
+          _slot.filePos = fh.position();
+          eof = !fh.available();
+          fh.close();
+        }
+        xSemaphoreGive( FileService::measureFileSem );
+        if ( !eof )
+          return false;
+      }
+      //
+      // next day
+      //
+      localtime_r( &_slot.day, &ti );
+      ti.tm_mday += 1;
+      ti.tm_isdst = -1;
+      _slot.day = mktime( &ti );
+      _slot.filePos = 0;
+      if ( _count >= prefs::WS_HISTORY_CHUNK || ++days >= prefs::WS_HISTORY_DAYS )
+        return _slot.day > lastDay;
+    }
+    return true;
+  }
+
+  /**
+   * one line from day file to a record
+   * 2024-05-27T12:14:13,4.07,002252,31.25 (temperature not in older lines)
+   */
+  bool LiveStream::parseDataLine( const char *_line, presure_data_t &_record )
+  {
+    struct tm ti{};
+    float bar;
+    unsigned mv;
+    float celsius;
+    int fields = sscanf( _line, "%4d-%2d-%2dT%2d:%2d:%2d,%f,%u,%f", &ti.tm_year, &ti.tm_mon, &ti.tm_mday, &ti.tm_hour, &ti.tm_min,
+                         &ti.tm_sec, &bar, &mv, &celsius );
+    if ( fields < 8 )
+      return false;
+    ti.tm_year -= 1900;
+    ti.tm_mon -= 1;
+    // local time of the day file, DST from the zone rules
+    ti.tm_isdst = -1;
+    _record.timestamp = static_cast< uint32_t >( mktime( &ti ) );
+    _record.pressureBar = bar;
+    _record.miliVolts = mv;
+    _record.temperature = fields == 9 ? static_cast< int16_t >( lroundf( celsius * 100.0F ) ) : TempComp::TEMP_UNKNOWN;
+    _record.reserved = 0;
+    return true;
+  }
+
+  /**
+   * copy a sample from the ring, false if not (longer) availible
+   */
+  bool LiveStream::getSample( uint32_t _seq, live_sample_t &_sample )
+  {
+    bool found{ false };
+    portENTER_CRITICAL( &LiveStream::ringMux );
+    if ( _seq < LiveStream::writeSeq && LiveStream::writeSeq - _seq <= prefs::LIVE_RING_SIZE )
+    {
+      _sample = LiveStream::ring[ _seq % prefs::LIVE_RING_SIZE ];
+      found = true;
+    }
+    portEXIT_CRITICAL( &LiveStream::ringMux );
+    return found;
+  }
+
+  /**
+   * one sample as json
+   * {"seq":12,"time":1716812053,"mv":2252,"bar":4.07,"filtered":4.05,"temp":31.25}
+   */
+  size_t LiveStream::formatSample( char *_buffer, size_t _size, const live_sample_t &_sample )
+  {
+    // numbers without printf, only strings are joined
+    char seq[ NumFormat::NUM_LEN ];
+    char epoch[ NumFormat::NUM_LEN ];
+    char miliVolts[ NumFormat::NUM_LEN ];
+    char bar[ NumFormat::NUM_LEN ];
+    char filtered[ NumFormat::NUM_LEN ];
+    char temperature[ NumFormat::NUM_LEN ];
+    NumFormat::u32( seq, sizeof( seq ), _sample.seq );
+    NumFormat::u32( epoch, sizeof( epoch ), _sample.epoch );
+    NumFormat::u32( miliVolts, sizeof( miliVolts ), _sample.miliVolts );
+    NumFormat::fixed( bar, sizeof( bar ), _sample.pressureBar, 2 );
+    NumFormat::fixed( filtered, sizeof( filtered ), _sample.filteredBar, 2 );
+    if ( _sample.temperature == TempComp::TEMP_UNKNOWN )
+      strcpy( temperature, "null" );
+    else
+      NumFormat::scaled( temperature, sizeof( temperature ), _sample.temperature, 2 );
+    int len = snprintf( _buffer, _size, "{\"seq\":%s,\"time\":%s,\"mv\":%s,\"bar\":%s,\"filtered\":%s,\"temp\":%s}", seq, epoch,
+                        miliVolts, bar, filtered, temperature );
+    if ( len < 0 || static_cast< size_t >( len ) >= _size )
+      return 0;
+    return static_cast< size_t >( len );
+  }
+
+}  // namespace measure_h2o
@@ -9,15 +9,21 @@
 #include "freertos/task.h"
 #include "sdkconfig.h"
 #include <Elog.h>
-#include <TimeLib.h>
 #include "filesystem.hpp"
 #include "appStati.hpp"
 #include "appPrefs.hpp"
 #include "fileService.hpp"
+#include "dataUploader.hpp"
+#include "liveStream.hpp"
+#include "heapMonitor.hpp"
 #include "ledStripe.hpp"
 #include "statics.hpp"
 #include "wifiConfig.hpp"
 #include "webServer.hpp"
+#include "timeKeeper.hpp"
+#include "anomalyMonitor.hpp"
+#include "pumpMonitor.hpp"
+#include "numFormat.hpp"
 #include "main.hpp"
 
 constexpr int64_t DELAYTIME = 750000LL;
@@ -26,6 +32,19 @@ constexpr int64_t ANTTIME = 1200000LL;
 constexpr int64_t CALIBRTIME = 255000LL;
 constexpr int64_t FORCE_DELAYTIME = 4000000LL;
 
+//
+// steps of the calibration key, loop() is never blocked
+//
+enum class CalibKey : uint8_t
+{
+  IDLE,          //! poll the key every CALIBRTIME
+  DEBOUNCE,      //! low, wait for the mechanic switch
+  MEASURE,       //! zero requested, wait for the measure task
+  REJECTED,      //! pressure on the sensor, alert while the key is down
+  WAIT_RELEASE,  //! done, wait for key up
+  HOLDOFF        //! after rejected, no new request for a while
+};
+
 void setup()
 {
   using namespace measure_h2o;
@@ -44,6 +63,19 @@ void setup()
   // file storage init
   //
   FileService::init();
+  PumpMonitor::init();
+  //
+  // optional push uploads to a collector
+  //
+  DataUploader::init();
+  //
+  // live stream for web clients
+  //
+  LiveStream::init();
+  //
+  // watch the heap, shed load before allocations fail
+  //
+  HeapMonitor::init();
   //
   // timezone settings
   // not correct functional on this c3 chip :-(
@@ -85,11 +117,6 @@ void setup()
   //  random init
   //
   randomSeed( analogRead( prefs::RAND_PIN ) );
-  //
-  // timeLib sync Time width system
-  //
-  setSyncInterval( 240 );
-  setSyncProvider( getNtpTime );
   sleep( 3 );
   display->clear();
 }
@@ -98,34 +125,17 @@ void loop()
 {
   using namespace measure_h2o;
 
-  static int64_t setNextTimeCorrect{ ( 1000LL * 1000LL * 21600LL ) };
   static int64_t nextTimeToDisplayValues = DELAYTIME;
   static int64_t nextTimeHartbeat = HARTBEATTIME;
   static int64_t nextAntTime = ANTTIME;
-  static int64_t nextTimeCalibrCheck = CALIBRTIME;
   static int64_t nextTimePanicReboot{ 0 };
   static bool antMarkShow{ false };
   uint64_t nowTime = esp_timer_get_time();
 
-  if ( setNextTimeCorrect < nowTime )
-  {
-    //
-    // somtimes correct elog time
-    //
-    setNextTimeCorrect = nowTime + ( 1000ULL * 1000ULL * 21600ULL );
-    correctTime();
-  }
-
-  if ( nowTime > nextTimeCalibrCheck )
-  {
-    //
-    // time to check if the master whish to calibre
-    //
-    nextTimeCalibrCheck = nowTime + CALIBRTIME;
-    auto result = controlCalibr();
-    if ( result > 0 )
-      nextTimeCalibrCheck = nowTime + 10000000ULL;
-  }
+  //
+  // check if the master whish to calibre
+  //
+  controlCalibr( nowTime );
 
   if ( nowTime > nextTimeToDisplayValues )
   {
@@ -180,124 +190,101 @@ void loop()
 }
 
 /**
- * cyclic called function to set time from NTP
+ * control calibre key, a small state machine (the measure task makes the measure)
  */
-time_t getNtpTime()
-{
-  if ( prefs::AppStati::getWlanState() == prefs::WlanState::TIMESYNCED )
-  {
-    struct tm ti;
-    if ( getLocalTime( &ti ) )
-    {
-      setTime( ti.tm_hour, ti.tm_min, ti.tm_sec, ti.tm_mday, ti.tm_mon + 1, ti.tm_year + 1900 );
-      return now();
-    }
-  }
-  return 0;
-}
-
-/**
- * correct time for logger
- */
-void correctTime()
-{
-  using namespace measure_h2o;
-  //
-  // somtimes correct elog time
-  //
-  elog.log( DEBUG, "main: logger time correction..." );
-  if ( prefs::AppStati::getWlanState() == prefs::WlanState::TIMESYNCED )
-  {
-    struct tm ti;
-    if ( !getLocalTime( &ti ) )
-    {
-      elog.log( WARNING, "main: failed to obtain system time!" );
-    }
-    else
-    {
-      elog.log( DEBUG, "main: gotten system time!" );
-      Elog::provideTime( ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday, ti.tm_hour, ti.tm_min, ti.tm_sec );
-      elog.log( DEBUG, "main: logger time correction...OK" );
-    }
-  }
-  else
-  {
-    elog.log( WARNING, "main: no time sync, no correction!" );
-  }
-}
-
-/**
- * control calibre key
- */
-int controlCalibr()
+void controlCalibr( int64_t _nowTime )
 {
   using namespace measure_h2o;
+  static CalibKey state{ CalibKey::IDLE };
+  static int64_t nextStepTime{ CALIBRTIME };
+  static bool alertToggle{ false };
 
-  auto cl_switch = digitalRead( prefs::CALIBR_REQ_PIN );
-  if ( cl_switch == LOW )
+  if ( _nowTime < nextStepTime )
+    return;
+  bool keyDown = digitalRead( prefs::CALIBR_REQ_PIN ) == LOW;
+  switch ( state )
   {
-    //
-    // there was an low impulse, is this permanent
-    //
-    elog.log( DEBUG, "main: calibrating requested???" );
-    //
-    // wait for mechanic switch
-    //
-    delay( 20 );
-    //
-    // after that, always low?
-    //
-    cl_switch = digitalRead( prefs::CALIBR_REQ_PIN );
-    if ( cl_switch == LOW )
-    {
-      //
-      // TODO: wait for key UP
-      // TODO: long keydown RESET device
-      //
-      String msg( "Druck erkannt!" );
-      String nix( "nicht moeglich" );
-      // maybe i can calibr?
-      elog.log( DEBUG, "main: calibrating requested!" );
-      // is ther a preasure in the sensor?
-      if ( prefs::CURRENT_BORDER_FOR_CALIBR < PrSensor::getCurrentValue() )
+    case CalibKey::IDLE:
+      nextStepTime = _nowTime + CALIBRTIME;
+      if ( keyDown )
       {
-        display->printAlert( msg );
-        delay( 2000 );
-        while ( digitalRead( prefs::CALIBR_REQ_PIN ) == LOW )
-        {
-          display->printAlert( nix );
-          delay( 800 );
-          display->printAlert( msg );
-          delay( 1000 );
-        }
-        return 1;
+        //
+        // there was an low impulse, is this permanent
+        //
+        elog.log( DEBUG, "main: calibrating requested???" );
+        state = CalibKey::DEBOUNCE;
+        nextStepTime = _nowTime + prefs::CALIBR_DEBOUNCE_YS;
+      }
+      break;
+
+    case CalibKey::DEBOUNCE:
+      if ( !keyDown )
+      {
+        state = CalibKey::IDLE;
+        break;
       }
-      else
       {
         //
-        // i should calibr the device
+        // i should calibr the device, if there is no pressure (checks the measure task)
         //
-        elog.log( DEBUG, "main: call calibre routine..." );
+        elog.log( DEBUG, "main: calibrating requested!" );
         String msg( "calibriere..." );
         display->printMessage( msg );
-        //
-        // calibrating sensor
-        //
-        PrSensor::calibreSensor();
-        msg = "fertig...       ";
+        PrSensor::requestZeroCalib();
+        state = CalibKey::MEASURE;
+        nextStepTime = _nowTime + CALIBRTIME;
+      }
+      break;
+
+    case CalibKey::MEASURE:
+      nextStepTime = _nowTime + CALIBRTIME;
+      if ( PrSensor::getZeroCalib() == ZeroCalib::DONE )
+      {
+        String msg( "fertig...       " );
         display->printMessage( msg );
-        elog.log( DEBUG, "main: call calibre routine...done" );
         elog.log( INFO, "calibre routine done" );
-        while ( digitalRead( prefs::CALIBR_REQ_PIN ) == LOW )
-        {
-          delay( 100 );
-          taskYIELD();
-        }
+        state = CalibKey::WAIT_RELEASE;
+      }
+      else if ( PrSensor::getZeroCalib() == ZeroCalib::REJECTED )
+      {
+        String msg( "Druck erkannt!" );
+        display->printAlert( msg );
+        alertToggle = false;
+        state = CalibKey::REJECTED;
+        nextStepTime = _nowTime + 2000000LL;
+      }
+      break;
+
+    case CalibKey::REJECTED:
+      if ( !keyDown )
+      {
+        state = CalibKey::HOLDOFF;
+        nextStepTime = _nowTime + prefs::CALIBR_HOLDOFF_YS;
+        break;
+      }
+      {
+        String msg( alertToggle ? "Druck erkannt!" : "nicht moeglich" );
+        display->printAlert( msg );
+        nextStepTime = _nowTime + ( alertToggle ? 1000000LL : 800000LL );
+        alertToggle = !alertToggle;
+      }
+      break;
+
+    case CalibKey::WAIT_RELEASE:
+      nextStepTime = _nowTime + 100000LL;
+      if ( !keyDown )
+      {
         elog.log( DEBUG, "main: continue" );
+        state = CalibKey::IDLE;
       }
-    }
+      break;
+
+    case CalibKey::HOLDOFF:
+    default:
+      state = CalibKey::IDLE;
+      nextStepTime = _nowTime + CALIBRTIME;
+      break;
   }
-  return 0;
 }
 
 /**
@@ -405,20 +392,23 @@ void updateDisplay()
   using namespace measure_h2o;
   static uint64_t nextTimeToForceShowPresure = FORCE_DELAYTIME;
   static int hour, minute, count;
+  static bool showAnomaly{ false };
   //
   // set display if changed
   //
   if ( prefs::AppStati::getWasChanged() || esp_timer_get_time() > nextTimeToForceShowPresure )
   {
     float pressureBar = prefs::AppStati::getCurrentPressureBar();
+    char pressure[ 16 ];
+    NumFormat::fixed( pressure, sizeof( pressure ), pressureBar, 2 );
 #ifdef BUILD_DEBUG
-    uint32_t mVolt = prefs::AppStati::getCurrentMiliVolts();
-    float volt = mVolt / 1000.0f;
+    char volt[ 16 ];
+    NumFormat::scaled( volt, sizeof( volt ), prefs::AppStati::getCurrentMiliVolts(), 3 );
     if ( prefs::AppStati::getWasChanged() )
-      elog.log( INFO, "main: pressure changed, raw value <%1.2f V>, pressure <%1.2f bar>", volt, pressureBar );
+      elog.log( INFO, "main: pressure changed, raw value <%s V>, pressure <%s bar>", volt, pressure );
 #else
     if ( prefs::AppStati::getWasChanged() )
-      elog.log( INFO, "main: pressure changed, pressure <%1.2f bar>", pressureBar );
+      elog.log( INFO, "main: pressure changed, pressure <%s bar>", pressure );
 #endif
     if ( esp_timer_get_time() > nextTimeToForceShowPresure )
     {
@@ -426,8 +416,9 @@ void updateDisplay()
       if ( prefs::AppStati::getWlanState() == WlanState::TIMESYNCED || SNTP_SYNC_STATUS_IN_PROGRESS == tsyncStatus )
       {
         struct tm ti;
-        if ( getLocalTime( &ti ) )
+        if ( TimeKeeper::isSynced() )
         {
+          TimeKeeper::toLocal( TimeKeeper::now(), ti );
           if ( hour != ti.tm_hour || minute != ti.tm_min || count > 4 )
           {
             // only if time changed
@@ -448,11 +439,43 @@ void updateDisplay()
       else
       {
         if ( SNTP_SYNC_STATUS_COMPLETED == tsyncStatus )
+        {
           prefs::AppStati::setWlanState( WlanState::TIMESYNCED );
+          // missed the sync notification?
+          if ( !TimeKeeper::isSynced() )
+            TimeKeeper::onSync( nullptr );
+        }
         display->printTime( "--:--" );
       }
     }
-    display->printPresure( pressureBar );
+    //
+    // a broken sensor is not "no pressure"
+    //
+    SensorState health = PrSensor::getHealthState();
+    AnomalyType anomaly = AnomalyMonitor::getActive();
+    if ( health == SensorState::OK && anomaly != AnomalyType::NONE && showAnomaly )
+    {
+      //
+      // an anomaly alternates with the pressure until acknowledged
+      //
+      String msg( anomaly == AnomalyType::NIGHT_DECAY    ? "Leck Verdacht!  "
+                  : anomaly == AnomalyType::PUMP_CYCLING ? "Pumpe taktet!   "
+                                                         : "Druckabfall!    " );
+      display->printAlert( msg );
+    }
+    else if ( health == SensorState::OK )
+    {
+      display->printPresure( pressureBar );
+    }
+    else
+    {
+      String msg( health == SensorState::OPEN    ? "Sensor offen!   "
+                  : health == SensorState::SHORT ? "Sensor Kurzschl."
+                  : health == SensorState::NOISY ? "Sensor rauscht! "
+                                                 : "Sensor haengt!  " );
+      display->printAlert( msg );
+    }
+    showAnomaly = !showAnomaly;
     prefs::AppStati::resetWasChanged();
     nextTimeToForceShowPresure = esp_timer_get_time() + FORCE_DELAYTIME;
   }
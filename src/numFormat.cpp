@@ -0,0 +1,195 @@
+#include "numFormat.hpp"
+
+namespace measure_h2o
+{
+  static const uint32_t POW10[ NumFormat::MAX_DECIMALS + 1 ] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL };
+
+  /**
+   * unsigned number, with leading zeros up to width
+   */
+  size_t NumFormat::u32( char *_buffer, size_t _size, uint32_t _value, uint8_t _width )
+  {
+    return NumFormat::digits( _buffer, _size, _value, _width );
+  }
+
+  /**
+   * signed number
+   */
+  size_t NumFormat::i32( char *_buffer, size_t _size, int32_t _value )
+  {
+    if ( _value >= 0 )
+      return NumFormat::digits( _buffer, _size, static_cast< uint64_t >( _value ), 0 );
+    if ( _size < 2 )
+    {
+      if ( _size )
+        *_buffer = '\0';
+      return 0;
+    }
+    // negate in 64 bit, INT32_MIN has no positive int32
+    size_t len = NumFormat::digits( _buffer + 1, _size - 1, static_cast< uint64_t >( -static_cast< int64_t >( _value ) ), 0 );
+    if ( len == 0 )
+    {
+      *_buffer = '\0';
+      return 0;
+    }
+    *_buffer = '-';
+    return len + 1;
+  }
+
+  /**
+   * fixed point number, value is the number * 10^decimals (e.g. 407, 2 => "4.07")
+   */
+  size_t NumFormat::scaled( char *_buffer, size_t _size, int64_t _value, uint8_t _decimals )
+  {
+    if ( _decimals > NumFormat::MAX_DECIMALS || _size == 0 )
+    {
+      if ( _size )
+        *_buffer = '\0';
+      return 0;
+    }
+    bool negative = _value < 0;
+    uint64_t abs = negative ? static_cast< uint64_t >( -( _value + 1 ) ) + 1ULL : static_cast< uint64_t >( _value );
+    uint64_t intPart = abs / POW10[ _decimals ];
+    uint32_t fracPart = static_cast< uint32_t >( abs % POW10[ _decimals ] );
+    size_t len{ 0 };
+    if ( negative )
+    {
+      if ( _size < 2 )
+      {
+        *_buffer = '\0';
+        return 0;
+      }
+      _buffer[ len++ ] = '-';
+    }
+    size_t intLen = NumFormat::digits( _buffer + len, _size - len, intPart, 0 );
+    if ( intLen == 0 )
+    {
+      *_buffer = '\0';
+      return 0;
+    }
+    len += intLen;
+    if ( _decimals == 0 )
+      return len;
+    // point, fraction and '\0'
+    if ( len + 1 + _decimals + 1 > _size )
+    {
+      *_buffer = '\0';
+      return 0;
+    }
+    _buffer[ len++ ] = '.';
+    len += NumFormat::digits( _buffer + len, _size - len, fracPart, _decimals );
+    return len;
+  }
+
+  /**
+   * float rounded (half away from zero) to decimals, not a number or too large gives 0 (caller decides)
+   */
+  size_t NumFormat::fixed( char *_buffer, size_t _size, float _value, uint8_t _decimals )
+  {
+    if ( _size )
+      *_buffer = '\0';
+    if ( _decimals > NumFormat::MAX_DECIMALS )
+      return 0;
+    float value = _value * static_cast< float >( POW10[ _decimals ] );
+    // also false for NaN
+    if ( !( value > -9.0e18F && value < 9.0e18F ) )
+      return 0;
+    int64_t rounded = static_cast< int64_t >( value < 0.0F ? value - 0.5F : value + 0.5F );
+    return NumFormat::scaled( _buffer, _size, rounded, _decimals );
+  }
+
+  /**
+   * ISO 8601 "YYYY-MM-DDTHH:MM:SS" of a broken down time
+   */
+  size_t NumFormat::isoDateTime( char *_buffer, size_t _size, const struct tm &_ti )
+  {
+    uint32_t year = static_cast< uint32_t >( _ti.tm_year + 1900 );
+    if ( _size < NumFormat::ISO_LEN || year > 9999 )
+    {
+      if ( _size )
+        *_buffer = '\0';
+      return 0;
+    }
+    char *cursor = NumFormat::put2( _buffer, year / 100 );
+    cursor = NumFormat::put2( cursor, year % 100 );
+    *cursor++ = '-';
+    cursor = NumFormat::put2( cursor, static_cast< uint32_t >( _ti.tm_mon + 1 ) );
+    *cursor++ = '-';
+    cursor = NumFormat::put2( cursor, static_cast< uint32_t >( _ti.tm_mday ) );
+    *cursor++ = 'T';
+    cursor = NumFormat::put2( cursor, static_cast< uint32_t >( _ti.tm_hour ) );
+    *cursor++ = ':';
+    cursor = NumFormat::put2( cursor, static_cast< uint32_t >( _ti.tm_min ) );
+    *cursor++ = ':';
+    cursor = NumFormat::put2( cursor, static_cast< uint32_t >( _ti.tm_sec ) );
+    *cursor = '\0';
+    return static_cast< size_t >( cursor - _buffer );
+  }
+
+  /**
+   * ISO 8601 of an epoch (UTC), days to civil date without gmtime
+   * (H. Hinnant, "chrono-Compatible Low-Level Date Algorithms")
+   */
+  size_t NumFormat::isoDateTime( char *_buffer, size_t _size, time_t _stamp )
+  {
+    if ( _stamp < 0 )
+    {
+      if ( _size )
+        *_buffer = '\0';
+      return 0;
+    }
+    struct tm ti = {};
+    int64_t stamp = static_cast< int64_t >( _stamp );
+    uint32_t secs = static_cast< uint32_t >( stamp % 86400 );
+    int64_t days = stamp / 86400 + 719468;
+    int64_t era = days / 146097;
+    uint32_t doe = static_cast< uint32_t >( days - era * 146097 );
+    uint32_t yoe = ( doe - doe / 1460 + doe / 36524 - doe / 146096 ) / 365;
+    uint32_t doy = doe - ( 365 * yoe + yoe / 4 - yoe / 100 );
+    uint32_t mp = ( 5 * doy + 2 ) / 153;
+    uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+    int64_t year = static_cast< int64_t >( yoe ) + era * 400 + ( month <= 2 ? 1 : 0 );
+    ti.tm_year = static_cast< int >( year - 1900 );
+    ti.tm_mon = static_cast< int >( month - 1 );
+    ti.tm_mday = static_cast< int >( doy - ( 153 * mp + 2 ) / 5 + 1 );
+    ti.tm_hour = static_cast< int >( secs / 3600 );
+    ti.tm_min = static_cast< int >( ( secs / 60 ) % 60 );
+    ti.tm_sec = static_cast< int >( secs % 60 );
+    return NumFormat::isoDateTime( _buffer, _size, ti );
+  }
+
+  /**
+   * decimal digits of a number, at least width (leading zeros)
+   */
+  size_t NumFormat::digits( char *_buffer, size_t _size, uint64_t _value, uint8_t _width )
+  {
+    char reverse[ 20 ];
+    size_t count{ 0 };
+    do
+    {
+      reverse[ count++ ] = static_cast< char >( '0' + _value % 10 );
+      _value /= 10;
+    } while ( _value );
+    size_t len = count > _width ? count : _width;
+    if ( len + 1 > _size )
+    {
+      if ( _size )
+        *_buffer = '\0';
+      return 0;
+    }
+    size_t idx{ 0 };
+    for ( ; idx < len - count; ++idx )
+      _buffer[ idx ] = '0';
+    while ( count )
+      _buffer[ idx++ ] = reverse[ --count ];
+    _buffer[ idx ] = '\0';
+    return len;
+  }
+
+  char *NumFormat::put2( char *_cursor, uint32_t _value )
+  {
+    *_cursor++ = static_cast< char >( '0' + ( _value / 10 ) % 10 );
+    *_cursor++ = static_cast< char >( '0' + _value % 10 );
+    return _cursor;
+  }
+}  // namespace measure_h2o
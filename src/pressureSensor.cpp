@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <Arduino.h>
 #include "statics.hpp"
 #include "pressureSensor.hpp"
@@ -5,13 +7,36 @@
 #include "appStructs.hpp"
 #include "appStati.hpp"
 #include "fileService.hpp"
+#include "dataUploader.hpp"
+#include "liveStream.hpp"
+#include "rtcJournal.hpp"
+#include "timeKeeper.hpp"
+#include "calibration.hpp"
+#include "anomalyMonitor.hpp"
+#include "rollingStats.hpp"
+#include "pumpMonitor.hpp"
 
 namespace measure_h2o
 {
   const char *PrSensor::tag{ "PrSensor" };
   gpio_num_t PrSensor::adcPin{ prefs::PRESSURE_GPIO };
-  volatile bool PrSensor::pauseMeasureTask{ false };
   int64_t PrSensor::interval_ys{ prefs::MEASURE_DIFF_TIME_S * 1000000ULL };
+  offline_record_t PrSensor::offlineRing[ prefs::OFFLINE_MAX_RECORDS ];
+  uint32_t PrSensor::offlineWritten{ 0 };
+  uint32_t PrSensor::offlineRead{ 0 };
+  uint32_t PrSensor::offlineDropped{ 0 };
+  volatile int32_t PrSensor::calibPointMbar{ PrSensor::NO_CALIB_POINT };
+  TempComp PrSensor::tempComp{ temp_comp_params_t{ prefs::TEMP_REF_CENTI_C, prefs::TEMP_STABLE_MV, prefs::TEMP_MIN_STEP_CENTI_C,
+                                                   prefs::TEMP_MIN_SUM_XX, prefs::TEMP_MAX_SUM_XX, prefs::TEMP_MAX_COEFF_Q16 } };
+  uint32_t PrSensor::tempLearnedSinceSave{ 0 };
+  volatile ZeroCalib PrSensor::zeroCalib{ ZeroCalib::NONE };
+  AutoZero PrSensor::autoZero{ auto_zero_params_t{ prefs::AUTOZERO_NEAR_MV, prefs::AUTOZERO_BAND_MV, prefs::AUTOZERO_MAX_SHIFT_MV,
+                                                   prefs::AUTOZERO_MAX_STEP_Q4, prefs::AUTOZERO_GAIN_SHIFT } };
+  volatile bool PrSensor::autoZeroOn{ false };
+  uint32_t PrSensor::zeroUpdatesSinceSave{ 0 };
+  SensorHealth PrSensor::health{ sensor_health_params_t{ prefs::HEALTH_OPEN_MV, prefs::HEALTH_SHORT_MV, prefs::HEALTH_NOISE_MV,
+                                                         prefs::HEALTH_STUCK_COUNT, prefs::HEALTH_CONFIRM_COUNT } };
+  volatile SensorState PrSensor::healthState{ SensorState::OK };
 
   TaskHandle_t PrSensor::taskHandle{ nullptr };
 
@@ -26,6 +51,10 @@ namespace measure_h2o
     analogSetAttenuation( ADC_11db );
     analogReadResolution( prefs::PRESSURE_RES );
     PrSensor::interval_ys = ( static_cast<int64_t>(prefs::AppStati::getMeasureInterval_s()) * 1000000LL );
+    Calibration::init();
+    PrSensor::tempComp.setCoefficient( prefs::AppStati::getTempCoefficient() );
+    PrSensor::autoZeroOn = prefs::AppStati::getAutoZero();
+    PrSensor::autoZero.setShiftQ4( PrSensor::autoZeroOn ? prefs::AppStati::getZeroShiftQ4() : 0 );
     PrSensor::start();
     elog.log( DEBUG, "%s: init pressure measure object...OK", PrSensor::tag );
   }
@@ -49,46 +78,82 @@ namespace measure_h2o
   }
 
   /**
-   * calibre the sensor
+   * the measure task sets the zero point at the next round, if there is no pressure
+   * (the key handler polls getZeroCalib, no blocking)
    */
-  bool PrSensor::calibreSensor()
+  void PrSensor::requestZeroCalib()
   {
-    //
-    // make measure thread sleep
-    //
-    PrSensor::pauseMeasureTask = true;
-    // wait a bit
-    taskYIELD();
-    delay( 1000 );
-    taskYIELD();
-    //
-    // read sensor value
-    //
-    PrSensor::doMeasure();
-    //
-    // set min volt == measured value
-    //
-    prefs::AppStati::setCalibreMinVal( prefs::AppStati::getCurrentMiliVolts() );
-    //
-    // compute calibre factor
-    //
-    // PrSensor::getCalibreFactor();
-    //
-    PrSensor::pauseMeasureTask = false;
-    taskYIELD();
-    return true;
+    PrSensor::zeroCalib = ZeroCalib::PENDING;
   }
 
   /**
-   * measure the tension from sensor for presure
+   * measure (task context), set min volt and the zero of the curve
    */
-  uint32_t PrSensor::getCurrentValue()
+  void PrSensor::calibreZero()
   {
-    PrSensor::pauseMeasureTask = true;
-    delay( 400U );
     PrSensor::doMeasure();
-    PrSensor::pauseMeasureTask = false;
-    return prefs::AppStati::getCurrentMiliVolts();
+    uint32_t miliVolts = prefs::AppStati::getCurrentMiliVolts();
+    if ( miliVolts > prefs::CURRENT_BORDER_FOR_CALIBR )
+    {
+      elog.log( WARNING, "%s: zero calibration rejected, <%d mV> on the sensor", PrSensor::tag, miliVolts );
+      PrSensor::zeroCalib = ZeroCalib::REJECTED;
+      return;
+    }
+    prefs::AppStati::setCalibreMinVal( miliVolts );
+    Calibration::addPoint( miliVolts, 0 );
+    // the new zero point replaces the tracked shift
+    PrSensor::autoZero.reset();
+    PrSensor::zeroUpdatesSinceSave = 0;
+    prefs::AppStati::setZeroShiftQ4( 0 );
+    PrSensor::doMeasure();
+    elog.log( INFO, "%s: zero point <%d mV> set", PrSensor::tag, miliVolts );
+    PrSensor::zeroCalib = ZeroCalib::DONE;
+  }
+
+  /**
+   * switch the zero tracking; off removes the shift (in the measure task)
+   */
+  void PrSensor::setAutoZero( bool _on )
+  {
+    prefs::AppStati::setAutoZero( _on );
+    PrSensor::autoZeroOn = _on;
+    elog.log( INFO, "%s: zero tracking %s", PrSensor::tag, _on ? "on" : "off" );
+  }
+
+  /**
+   * idle windows (pump off, line drained) move the zero shift slowly, saved now and then
+   */
+  void PrSensor::trackZero()
+  {
+    if ( !PrSensor::autoZeroOn )
+    {
+      if ( PrSensor::autoZero.getShiftQ4() != 0 )
+      {
+        PrSensor::autoZero.reset();
+        prefs::AppStati::setZeroShiftQ4( 0 );
+      }
+      return;
+    }
+    // a stuck or noisy sensor must not move the zero point
+    if ( PrSensor::healthState != SensorState::OK )
+      return;
+    if ( !PrSensor::autoZero.update( prefs::AppStati::getCurrentMiliVolts(), Calibration::getZeroMv() ) )
+      return;
+    elog.log( DEBUG, "%s: zero shift <%d> (1/16 mV)", PrSensor::tag, PrSensor::autoZero.getShiftQ4() );
+    if ( ++PrSensor::zeroUpdatesSinceSave >= prefs::AUTOZERO_SAVE_UPDATES )
+    {
+      PrSensor::zeroUpdatesSinceSave = 0;
+      prefs::AppStati::setZeroShiftQ4( PrSensor::autoZero.getShiftQ4() );
+    }
+  }
+
+  /**
+   * the measure task takes a point of the calibration curve at the next round
+   * (the reference pressure must be on the sensor)
+   */
+  void PrSensor::requestCalibPoint( int32_t _mbar )
+  {
+    PrSensor::calibPointMbar = _mbar;
   }
 
   /**
@@ -100,24 +165,60 @@ namespace measure_h2o
     // measure
     // 8 times measure, ackumulate, then div 8
     //
+    uint16_t readValues[ 8 ];
     uint32_t readValuesSum{ 0UL };
     // set flag it was mesured
     prefs::AppStati::wasMeasure = true;
     for ( int idx = 0; idx < 8; idx++ )
     {
       // read value
-      readValuesSum += analogReadMilliVolts( prefs::PRESSURE_GPIO );
+      readValues[ idx ] = static_cast< uint16_t >( analogReadMilliVolts( prefs::PRESSURE_GPIO ) );
+      readValuesSum += readValues[ idx ];
       delay( 8 );
     }
     // average minus bias
-    uint32_t cMiliVolts = ( readValuesSum >> 3 );
+    uint32_t rawMiliVolts = ( readValuesSum >> 3 );
+    //
+    // diagnostics from the single readings (rail, scatter, stuck)
+    //
+    if ( PrSensor::health.check( readValues, 8 ) )
+    {
+      SensorState state = PrSensor::health.getState();
+      PrSensor::healthState = state;
+      elog.log( state == SensorState::OK ? INFO : ERROR, "%s: sensor health <%s> (%d mV, spread %d mV)", PrSensor::tag,
+                SensorHealth::getName( state ), rawMiliVolts, PrSensor::health.getSpreadMv() );
+    }
+    bool healthy = PrSensor::health.getState() == SensorState::OK;
+    //
+    // chip temperature, learn and compensate the drift of the analog part
+    //
+    int16_t centiC = PrSensor::readTemperature();
+    prefs::AppStati::setCurrentTemperature( centiC );
+    if ( healthy && PrSensor::tempComp.learn( centiC, rawMiliVolts ) && ++PrSensor::tempLearnedSinceSave >= prefs::TEMP_SAVE_PAIRS )
+    {
+      PrSensor::tempLearnedSinceSave = 0;
+      prefs::AppStati::setTempCoefficient( PrSensor::tempComp.getCoefficient() );
+      elog.log( DEBUG, "%s: temperature coefficient <%d> (Q16) saved", PrSensor::tag, PrSensor::tempComp.getCoefficient() );
+    }
+    uint32_t cMiliVolts = PrSensor::tempComp.compensate( rawMiliVolts, centiC );
     prefs::AppStati::setCurrentMiliVolts( cMiliVolts );
-    double volts = ( cMiliVolts - prefs::AppStati::getCalibreMinVal() ) / 1000.0;
-    float cBar = volts * prefs::AppStati::getCalibreFactor();
-    if ( cBar < 0.0F || cBar > 6.0F )
-      prefs::AppStati::setCurrentPressureBar( 0.0F );
+    // curve or zero point and factor, no float (tracked zero shift removed first)
+    int32_t cMbar = Calibration::toMbar( PrSensor::autoZero.apply( cMiliVolts ) );
+    if ( cMbar < 0 || cMbar > prefs::PRESSURE_MAX_MBAR )
+      prefs::AppStati::setCurrentPressureMbar( 0 );
     else
-      prefs::AppStati::setCurrentPressureBar( cBar );
+      prefs::AppStati::setCurrentPressureMbar( cMbar );
+  }
+
+  /**
+   * internal temperature sensor in 0.01 °C, TEMP_UNKNOWN if not plausible
+   */
+  int16_t PrSensor::readTemperature()
+  {
+    float celsius = temperatureRead();
+    if ( !( celsius > -40.0F && celsius < 125.0F ) )
+      return TempComp::TEMP_UNKNOWN;
+    return static_cast< int16_t >( lroundf( celsius * 100.0F ) );
   }
 
   /**
@@ -130,12 +231,27 @@ namespace measure_h2o
     while ( true )
     {
       //
-      // if an other process work here (i.e. calibre pressure)
-      // or there is no tiome availible
-      // make a break ;-)
+      // zero point requested (calibration key)
+      //
+      if ( PrSensor::zeroCalib == ZeroCalib::PENDING )
+        PrSensor::calibreZero();
+      //
+      // point for the calibration curve requested (api)
+      //
+      int32_t calibMbar = PrSensor::calibPointMbar;
+      if ( calibMbar != PrSensor::NO_CALIB_POINT )
+      {
+        PrSensor::calibPointMbar = PrSensor::NO_CALIB_POINT;
+        PrSensor::doMeasure();
+        // same base as the curve lookup in doMeasure (tracked zero shift removed)
+        Calibration::addPoint( PrSensor::autoZero.apply( prefs::AppStati::getCurrentMiliVolts() ), calibMbar );
+      }
+      //
+      // first time sync, the wall clock is valid from now on
+      // (stays valid if WLAN or NTP is lost later)
       //
-      while ( PrSensor::pauseMeasureTask || ( prefs::AppStati::getWlanState() != WlanState::TIMESYNCED ) )
-        delay( 500U );
+      if ( TimeKeeper::isSynced() && PrSensor::getOfflineCount() > 0 )
+        PrSensor::restampOffline();
       //
       // normal task
       //
@@ -148,18 +264,35 @@ namespace measure_h2o
         //
         // measure
         //
+        time_stamp_t measureTime = TimeKeeper::stamp();
         PrSensor::doMeasure();
+        PrSensor::trackZero();
+        if ( PrSensor::healthState == SensorState::OK )
+          RollingStats::add( prefs::AppStati::getCurrentPressureMbar() );
         //
-        // do save
+        // do save, without valid time with the monotonic clock (restamp after sync),
+        // also while older offline measures wait (the day file stays in time order)
         //
-        presure_data_t dataset;
-        char buffer[ 24 ];
-        snprintf( buffer, 22, "%04d-%02d-%02dT%02d:%02d:%02d\0", year(), month(), day(), hour(), minute(), second() );
-        String tmStr( buffer );
-        dataset.timestamp = buffer;
-        dataset.miliVolts = prefs::AppStati::getCurrentMiliVolts();
-        dataset.pressureBar = prefs::AppStati::getCurrentPressureBar();
-        FileService::dataset.push_back( dataset );
+        if ( measureTime.wallYs > 0 && PrSensor::getOfflineCount() == 0 )
+        {
+          presure_data_t dataset;
+          dataset.timestamp = static_cast< uint32_t >( measureTime.wallYs / 1000000LL );
+          dataset.miliVolts = prefs::AppStati::getCurrentMiliVolts();
+          dataset.pressureBar = prefs::AppStati::getCurrentPressureBar();
+          dataset.temperature = prefs::AppStati::getCurrentTemperature();
+          dataset.reserved = 0;
+          PrSensor::storeMeasure( dataset );
+          // leak and pump anomalys, pump cycles only from a working sensor
+          if ( PrSensor::healthState == SensorState::OK )
+          {
+            AnomalyMonitor::process( dataset.timestamp, prefs::AppStati::getCurrentPressureMbar() );
+            PumpMonitor::process( dataset.timestamp, prefs::AppStati::getCurrentPressureMbar() );
+          }
+        }
+        else
+        {
+          PrSensor::bufferOffline( measureTime.monoYs );
+        }
         delay( 350U );
         display->hideMeasureMark();
       }
@@ -167,4 +300,79 @@ namespace measure_h2o
     }
   }
 
+  /**
+   * a measure with valid time to the day file (journal first), upload and live stream
+   */
+  void PrSensor::storeMeasure( const presure_data_t &_data )
+  {
+    RtcJournal::append( _data );
+    FileService::dataset.push_back( _data );
+    DataUploader::enqueue( _data );
+    LiveStream::publish( _data );
+  }
+
+  /**
+   * current measure into the offline ring, if full the oldest is lost
+   */
+  void PrSensor::bufferOffline( int64_t _monoYs )
+  {
+    offline_record_t &rec = PrSensor::offlineRing[ PrSensor::offlineWritten % prefs::OFFLINE_MAX_RECORDS ];
+    rec.monoYs = _monoYs;
+    rec.miliVolts = prefs::AppStati::getCurrentMiliVolts();
+    rec.pressureBar = prefs::AppStati::getCurrentPressureBar();
+    rec.temperature = prefs::AppStati::getCurrentTemperature();
+    ++PrSensor::offlineWritten;
+    if ( PrSensor::offlineWritten - PrSensor::offlineRead > prefs::OFFLINE_MAX_RECORDS )
+      ++PrSensor::offlineDropped;
+  }
+
+  /**
+   * time is synced: wall clock from the monotonic stamp, store the offline measures (oldest first)
+   * the ring holds more than the journal, the records go directly into the day files;
+   * records not saved (files busy, can't open) stay in the ring for the next round
+   */
+  void PrSensor::restampOffline()
+  {
+    size_t count = PrSensor::getOfflineCount();
+    uint32_t first = PrSensor::offlineWritten - count;
+    presure_data_set_t restamped;
+    restamped.reserve( count );
+    for ( size_t i = 0; i < count; ++i )
+      restamped.push_back( PrSensor::restamp( PrSensor::offlineRing[ ( first + i ) % prefs::OFFLINE_MAX_RECORDS ] ) );
+    size_t saved = FileService::saveDirect( restamped );
+    for ( size_t i = 0; i < saved; ++i )
+      DataUploader::enqueue( PrSensor::restamp( PrSensor::offlineRing[ ( first + i ) % prefs::OFFLINE_MAX_RECORDS ] ) );
+    if ( saved < count )
+    {
+      PrSensor::offlineRead = first + static_cast< uint32_t >( saved );
+      elog.log( WARNING, "%s: <%d> offline measures restamped, <%d> wait", PrSensor::tag, saved, count - saved );
+      return;
+    }
+    PrSensor::offlineWritten = 0;
+    PrSensor::offlineRead = 0;
+    elog.log( INFO, "%s: time synced, <%d> offline measures restamped", PrSensor::tag, count );
+  }
+
+  /**
+   * record with wall clock of an offline measure (time is synced)
+   */
+  presure_data_t PrSensor::restamp( const offline_record_t &_rec )
+  {
+    presure_data_t dataset;
+    dataset.timestamp = static_cast< uint32_t >( TimeKeeper::toWallYs( _rec.monoYs ) / 1000000LL );
+    dataset.miliVolts = _rec.miliVolts;
+    dataset.pressureBar = _rec.pressureBar;
+    dataset.temperature = _rec.temperature;
+    dataset.reserved = 0;
+    return dataset;
+  }
+
+  /**
+   * measures waiting for time sync
+   */
+  size_t PrSensor::getOfflineCount()
+  {
+    return std::min( static_cast< size_t >( PrSensor::offlineWritten - PrSensor::offlineRead ), prefs::OFFLINE_MAX_RECORDS );
+  }
+
 }  // namespace measure_h2o
\ No newline at end of file
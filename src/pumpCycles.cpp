@@ -0,0 +1,66 @@
+#include "pumpCycles.hpp"
+
+namespace measure_h2o
+{
+  PumpCycleDetector::PumpCycleDetector( const pump_cycle_params_t &_params )
+      : params( _params ), hasLast( false ), lastSec( 0 ), lastMbar( 0 ), pumpOn( false ), cycle{}, peakSec( 0 ), lastEndSec( 0 )
+  {
+  }
+
+  /**
+   * one measure; a cycle is finished with the first measure that doesn't rise any more
+   */
+  bool PumpCycleDetector::update( uint32_t _sec, int32_t _mbar, pump_cycle_t &_cycle )
+  {
+    bool finished{ false };
+    if ( !hasLast || _sec <= lastSec || _sec - lastSec > params.maxGapS )
+    {
+      // no measures for a while, the running cycle is lost
+      pumpOn = false;
+      hasLast = true;
+      lastSec = _sec;
+      lastMbar = _mbar;
+      return false;
+    }
+    int32_t rise = _mbar - lastMbar;
+    if ( !pumpOn )
+    {
+      if ( rise >= params.startMbar )
+      {
+        pumpOn = true;
+        cycle = pump_cycle_t{};
+        cycle.start = lastSec;
+        cycle.startMbar = static_cast< int16_t >( lastMbar );
+        cycle.peakMbar = static_cast< int16_t >( _mbar );
+        peakSec = _sec;
+        uint32_t offSec = lastEndSec > 0 && lastSec > lastEndSec ? lastSec - lastEndSec : PUMP_OFF_UNKNOWN;
+        cycle.offSec = static_cast< uint16_t >( offSec < PUMP_OFF_UNKNOWN ? offSec : PUMP_OFF_UNKNOWN );
+      }
+    }
+    else if ( rise >= params.stopMbar )
+    {
+      // still rising
+      cycle.peakMbar = static_cast< int16_t >( _mbar );
+      peakSec = _sec;
+    }
+    else
+    {
+      //
+      // peak reached, the cycle is complete
+      //
+      uint32_t onSec = peakSec - cycle.start;
+      cycle.onSec = static_cast< uint16_t >( onSec < 0xffffU ? onSec : 0xffffU );
+      cycle.rateMbarMin = static_cast< int16_t >( ( ( cycle.peakMbar - cycle.startMbar ) * 60 ) / static_cast< int32_t >( onSec ) );
+      bool shortOn = onSec < params.shortOnS;
+      bool shortDistance = cycle.offSec != PUMP_OFF_UNKNOWN && cycle.offSec < params.shortDistanceS;
+      cycle.flags = ( shortOn || shortDistance ) ? PUMP_CYCLE_SHORT : 0;
+      lastEndSec = peakSec;
+      pumpOn = false;
+      _cycle = cycle;
+      finished = true;
+    }
+    lastSec = _sec;
+    lastMbar = _mbar;
+    return finished;
+  }
+}  // namespace measure_h2o
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <SPIFFS.h>
+#include "statics.hpp"
+#include "pumpMonitor.hpp"
+
+namespace measure_h2o
+{
+  const char *PumpMonitor::tag{ "PumpMonitor" };
+  SemaphoreHandle_t PumpMonitor::logSem{ nullptr };
+  portMUX_TYPE PumpMonitor::cycleMux = portMUX_INITIALIZER_UNLOCKED;
+  PumpCycleDetector PumpMonitor::detector{ pump_cycle_params_t{ prefs::PUMP_START_MBAR, prefs::PUMP_STOP_MBAR, prefs::PUMP_MAX_GAP_S,
+                                                                prefs::PUMP_SHORT_ON_S, prefs::PUMP_SHORT_DISTANCE_S } };
+  pump_cycle_t PumpMonitor::lastCycle{};
+  uint32_t PumpMonitor::cycleCount{ 0 };
+  uint32_t PumpMonitor::shortCount{ 0 };
+  uint32_t PumpMonitor::logErrors{ 0 };
+
+  /**
+   * init this object (single)
+   */
+  void PumpMonitor::init()
+  {
+    elog.log( INFO, "%s: init pump cycle log...", PumpMonitor::tag );
+    if ( PumpMonitor::logSem )
+      return;
+    vSemaphoreCreateBinary( PumpMonitor::logSem );
+  }
+
+  /**
+   * a measure into the detector (measure task), finished cycles into the log
+   */
+  void PumpMonitor::process( uint32_t _timestamp, int32_t _mbar )
+  {
+    pump_cycle_t cycle;
+    if ( !PumpMonitor::detector.update( _timestamp, _mbar, cycle ) )
+      return;
+    bool isShort = ( cycle.flags & PUMP_CYCLE_SHORT ) != 0;
+    portENTER_CRITICAL( &PumpMonitor::cycleMux );
+    PumpMonitor::lastCycle = cycle;
+    ++PumpMonitor::cycleCount;
+    if ( isShort )
+      ++PumpMonitor::shortCount;
+    portEXIT_CRITICAL( &PumpMonitor::cycleMux );
+    elog.log( isShort ? WARNING : INFO, "%s: %spump cycle, on <%u s>, off <%u s>, <%d> to <%d> mbar, rate <%d mbar/min>",
+              PumpMonitor::tag, isShort ? "SHORT " : "", cycle.onSec, cycle.offSec, cycle.startMbar, cycle.peakMbar,
+              cycle.rateMbarMin );
+    if ( !PumpMonitor::append( cycle ) )
+      ++PumpMonitor::logErrors;
+  }
+
+  /**
+   * copy of the newest cycle
+   */
+  bool PumpMonitor::getLastCycle( pump_cycle_t &_cycle )
+  {
+    portENTER_CRITICAL( &PumpMonitor::cycleMux );
+    bool found = PumpMonitor::cycleCount > 0;
+    if ( found )
+      _cycle = PumpMonitor::lastCycle;
+    portEXIT_CRITICAL( &PumpMonitor::cycleMux );
+    return found;
+  }
+
+  /**
+   * internal: record at the end of the log, a full log becomes the old log
+   */
+  bool PumpMonitor::append( const pump_cycle_t &_cycle )
+  {
+    if ( !PumpMonitor::logSem || xSemaphoreTake( PumpMonitor::logSem, pdMS_TO_TICKS( 2000 ) ) != pdTRUE )
+      return false;
+    if ( SPIFFS.exists( prefs::PUMP_LOG_FILE ) )
+    {
+      File check = SPIFFS.open( prefs::PUMP_LOG_FILE, "r" );
+      size_t size = check ? check.size() : 0;
+      check.close();
+      // full, or a torn record (power loss while writing) would shift all records after
+      if ( size >= prefs::PUMP_LOG_MAX_RECORDS * sizeof( pump_cycle_t ) || size % sizeof( pump_cycle_t ) != 0 )
+      {
+        elog.log( INFO, "%s: cycle log full, move to <%s>", PumpMonitor::tag, prefs::PUMP_LOG_OLD_FILE );
+        SPIFFS.remove( prefs::PUMP_LOG_OLD_FILE );
+        SPIFFS.rename( prefs::PUMP_LOG_FILE, prefs::PUMP_LOG_OLD_FILE );
+      }
+    }
+    bool written{ false };
+    File fh = SPIFFS.open( prefs::PUMP_LOG_FILE, "a", true );
+    if ( fh )
+    {
+      written = fh.write( reinterpret_cast< const uint8_t * >( &_cycle ), sizeof( pump_cycle_t ) ) == sizeof( pump_cycle_t );
+      fh.close();
+    }
+    xSemaphoreGive( PumpMonitor::logSem );
+    if ( !written )
+      elog.log( ERROR, "%s: can't write cycle log <%s>!", PumpMonitor::tag, prefs::PUMP_LOG_FILE );
+    return written;
+  }
+
+  /**
+   * the newest records of the current log (oldest first), returns the count
+   */
+  size_t PumpMonitor::readLast( pump_cycle_t *_cycles, size_t _max )
+  {
+    size_t count{ 0 };
+    if ( !PumpMonitor::logSem || xSemaphoreTake( PumpMonitor::logSem, pdMS_TO_TICKS( 1500 ) ) != pdTRUE )
+      return 0;
+    File fh = SPIFFS.exists( prefs::PUMP_LOG_FILE ) ? SPIFFS.open( prefs::PUMP_LOG_FILE, "r" ) : File();
+    if ( fh )
+    {
+      // a torn record at the end is ignored
+      size_t records = fh.size() / sizeof( pump_cycle_t );
+      count = std::min( records, _max );
+      fh.seek( ( records - count ) * sizeof( pump_cycle_t ) );
+      size_t len = fh.read( reinterpret_cast< uint8_t * >( _cycles ), count * sizeof( pump_cycle_t ) );
+      count = len / sizeof( pump_cycle_t );
+      fh.close();
+    }
+    xSemaphoreGive( PumpMonitor::logSem );
+    return count;
+  }
+}  // namespace measure_h2o
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <stdio.h>
+#include "statics.hpp"
+#include "requestArena.hpp"
+
+namespace measure_h2o
+{
+  const char *RequestArena::tag{ "RequestArena" };
+  RequestArena RequestArena::pool[ prefs::ARENA_BLOCKS ];
+  uint32_t RequestArena::usedCount{ 0 };
+  uint32_t RequestArena::usedPeak{ 0 };
+  uint32_t RequestArena::exhaustedCount{ 0 };
+
+  //
+  // send if the body don't fit into the block
+  //
+  static const char TOO_LARGE_MSG[] PROGMEM = "response too large";
+
+  /**
+   * the block of the request, takes a free block for a new request
+   * the block is free if the request is gone, the only user of request->onDisconnect
+   */
+  RequestArena *RequestArena::get( AsyncWebServerRequest *request )
+  {
+    RequestArena *freeBlock{ nullptr };
+    for ( RequestArena &arena : RequestArena::pool )
+    {
+      if ( arena.owner == request )
+        return &arena;
+      if ( !arena.owner && !freeBlock )
+        freeBlock = &arena;
+    }
+    if ( !freeBlock )
+    {
+      ++RequestArena::exhaustedCount;
+      elog.log( WARNING, "%s: all blocks in use, <%s>", RequestArena::tag, request->url().c_str() );
+      return nullptr;
+    }
+    freeBlock->owner = request;
+    freeBlock->onRelease = nullptr;
+    freeBlock->head = 0;
+    freeBlock->tail = 0;
+    freeBlock->filler = nullptr;
+    freeBlock->part = 0;
+    freeBlock->overflow = false;
+    ++RequestArena::usedCount;
+    if ( RequestArena::usedCount > RequestArena::usedPeak )
+      RequestArena::usedPeak = RequestArena::usedCount;
+    request->onDisconnect( [ freeBlock ]() { freeBlock->release(); } );
+    return freeBlock;
+  }
+
+  size_t RequestArena::write( uint8_t ch )
+  {
+    if ( head + 1 >= sizeof( block ) )
+    {
+      overflow = true;
+      return 0;
+    }
+    block[ head++ ] = static_cast< char >( ch );
+    return 1;
+  }
+
+  size_t RequestArena::write( const uint8_t *buffer, size_t len )
+  {
+    if ( head + len >= sizeof( block ) )
+    {
+      overflow = true;
+      return 0;
+    }
+    memcpy( block + head, buffer, len );
+    head += len;
+    return len;
+  }
+
+  bool RequestArena::append( const char *fmt, ... )
+  {
+    va_list args;
+    va_start( args, fmt );
+    bool ok = vappend( fmt, args );
+    va_end( args );
+    return ok;
+  }
+
+  /**
+   * format direct into the block, behind the body
+   */
+  bool RequestArena::vappend( const char *fmt, va_list args )
+  {
+    size_t space = sizeof( block ) - head;
+    int len = vsnprintf( block + head, space, fmt, args );
+    if ( len < 0 || static_cast< size_t >( len ) >= space )
+    {
+      overflow = true;
+      block[ head ] = 0;
+      return false;
+    }
+    head += len;
+    return true;
+  }
+
+  const char *RequestArena::c_str()
+  {
+    block[ head ] = 0;
+    return block;
+  }
+
+  void RequestArena::setOnRelease( arena_release_t _onRelease )
+  {
+    onRelease = _onRelease;
+  }
+
+  /**
+   * response direct from the block, the block lives until the request is gone
+   */
+  AsyncWebServerResponse *RequestArena::beginResponse( int code, const char *contentType )
+  {
+    if ( overflow )
+    {
+      elog.log( ERROR, "%s: response too large for <%s>", RequestArena::tag, owner->url().c_str() );
+      return owner->beginResponse_P( 500, "text/plain", reinterpret_cast< const uint8_t * >( TOO_LARGE_MSG ),
+                                     sizeof( TOO_LARGE_MSG ) - 1 );
+    }
+    return owner->beginResponse_P( code, contentType, reinterpret_cast< const uint8_t * >( block ), head );
+  }
+
+  void RequestArena::send( int code, const char *contentType )
+  {
+    owner->send( beginResponse( code, contentType ) );
+  }
+
+  /**
+   * chunked response, the parts are written into the block when the connection wants more data
+   * a text part must fit into the block, else it is cut after the last complete line (logged)
+   */
+  void RequestArena::sendChunked( const char *contentType, arena_fill_t _filler )
+  {
+    head = 0;
+    tail = 0;
+    part = 0;
+    overflow = false;
+    filler = _filler;
+    RequestArena *self = this;
+    owner->send( owner->beginChunkedResponse( contentType, [ self ]( uint8_t *buffer, size_t maxLen, size_t ) -> size_t {
+      return self->fillChunk( buffer, maxLen );
+    } ) );
+  }
+
+  /**
+   * internal: copy from the current part, write the next part if the block is sent
+   */
+  size_t RequestArena::fillChunk( uint8_t *buffer, size_t maxLen )
+  {
+    while ( tail >= head )
+    {
+      if ( !filler )
+        return 0;
+      head = 0;
+      tail = 0;
+      overflow = false;
+      if ( !filler( *this, part ) )
+      {
+        filler = nullptr;
+        return 0;
+      }
+      if ( overflow )
+      {
+        elog.log( ERROR, "%s: part <%d> too large for <%s>, cut", RequestArena::tag, part, owner->url().c_str() );
+        while ( head > 0 && block[ head - 1 ] != '\n' )
+          --head;
+      }
+      ++part;
+    }
+    size_t len = std::min( head - tail, maxLen );
+    memcpy( buffer, block + tail, len );
+    tail += len;
+    return len;
+  }
+
+  void RequestArena::release()
+  {
+    if ( onRelease )
+      onRelease();
+    onRelease = nullptr;
+    owner = nullptr;
+    if ( RequestArena::usedCount > 0 )
+      --RequestArena::usedCount;
+  }
+}  // namespace measure_h2o
@@ -0,0 +1,44 @@
+#include "rollingStats.hpp"
+
+namespace measure_h2o
+{
+  static_assert( prefs::STATS_WINDOW_COUNT == 4, "rolling statistics windows changed!" );
+
+  portMUX_TYPE RollingStats::statsMux = portMUX_INITIALIZER_UNLOCKED;
+  RollingWindow RollingStats::windows[ prefs::STATS_WINDOW_COUNT ]{
+      RollingWindow( prefs::STATS_WINDOW_S[ 0 ] ), RollingWindow( prefs::STATS_WINDOW_S[ 1 ] ),
+      RollingWindow( prefs::STATS_WINDOW_S[ 2 ] ), RollingWindow( prefs::STATS_WINDOW_S[ 3 ] ) };
+  const char *const RollingStats::names[ prefs::STATS_WINDOW_COUNT ]{ "1m", "15m", "1h", "24h" };
+
+  /**
+   * a measure into all windows
+   */
+  void RollingStats::add( int32_t _mbar )
+  {
+    uint32_t nowSec = static_cast< uint32_t >( esp_timer_get_time() / 1000000LL );
+    portENTER_CRITICAL( &RollingStats::statsMux );
+    for ( size_t idx = 0; idx < prefs::STATS_WINDOW_COUNT; ++idx )
+      RollingStats::windows[ idx ].add( nowSec, _mbar );
+    portEXIT_CRITICAL( &RollingStats::statsMux );
+  }
+
+  /**
+   * aggregates of a window, old buckets expire first (no measures for a while)
+   */
+  bool RollingStats::get( size_t _idx, rolling_stats_t &_stats )
+  {
+    if ( _idx >= prefs::STATS_WINDOW_COUNT )
+      return false;
+    uint32_t nowSec = static_cast< uint32_t >( esp_timer_get_time() / 1000000LL );
+    portENTER_CRITICAL( &RollingStats::statsMux );
+    RollingStats::windows[ _idx ].advance( nowSec );
+    RollingStats::windows[ _idx ].get( _stats );
+    portEXIT_CRITICAL( &RollingStats::statsMux );
+    return true;
+  }
+
+  const char *RollingStats::getName( size_t _idx )
+  {
+    return _idx < prefs::STATS_WINDOW_COUNT ? RollingStats::names[ _idx ] : "unknown";
+  }
+}  // namespace measure_h2o
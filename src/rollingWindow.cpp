@@ -0,0 +1,130 @@
+#include "rollingWindow.hpp"
+#include "intMath.hpp"
+
+namespace measure_h2o
+{
+  RollingWindow::RollingWindow( uint32_t _spanSec )
+      : bucketSec( _spanSec / BUCKETS > 0 ? _spanSec / BUCKETS : 1 ), buckets{}, current( 0 ), started( false ), totCount( 0 ),
+        totSum( 0 ), totSumSq( 0 ), minQueue{}, minHead( 0 ), minLen( 0 ), maxQueue{}, maxHead( 0 ), maxLen( 0 )
+  {
+  }
+
+  /**
+   * a sample into the current bucket
+   */
+  void RollingWindow::add( uint32_t _sec, int32_t _value )
+  {
+    advance( _sec );
+    bucket_t &bucket = buckets[ current % BUCKETS ];
+    if ( bucket.count == 0 || _value < bucket.min )
+      bucket.min = _value;
+    if ( bucket.count == 0 || _value > bucket.max )
+      bucket.max = _value;
+    ++bucket.count;
+    bucket.sum += _value;
+    bucket.sumSq += static_cast< int64_t >( _value ) * _value;
+  }
+
+  /**
+   * close the buckets up to the time, the oldest fall out of the window
+   */
+  void RollingWindow::advance( uint32_t _sec )
+  {
+    uint32_t target = _sec / bucketSec;
+    if ( !started || target < current || target - current >= BUCKETS )
+    {
+      // first sample, clock back or the whole window is old: start empty
+      for ( size_t idx = 0; idx < BUCKETS; ++idx )
+        buckets[ idx ] = bucket_t{};
+      totCount = 0;
+      totSum = totSumSq = 0;
+      minLen = maxLen = 0;
+      current = target;
+      started = true;
+      return;
+    }
+    while ( current < target )
+    {
+      closeCurrent();
+      ++current;
+      expire();
+      buckets[ current % BUCKETS ] = bucket_t{};
+    }
+  }
+
+  /**
+   * aggregates over the closed buckets and the current one
+   */
+  void RollingWindow::get( rolling_stats_t &_stats ) const
+  {
+    const bucket_t &open = buckets[ current % BUCKETS ];
+    uint64_t count = static_cast< uint64_t >( totCount ) + open.count;
+    _stats.count = static_cast< uint32_t >( count );
+    if ( count == 0 )
+    {
+      _stats.min = _stats.max = _stats.meanCenti = 0;
+      _stats.stddevCenti = 0;
+      return;
+    }
+    int64_t sum = totSum + open.sum;
+    int64_t sumSq = totSumSq + open.sumSq;
+    bool hasClosed = minLen > 0;
+    int32_t minVal = hasClosed ? buckets[ minQueue[ minHead ] % BUCKETS ].min : open.min;
+    int32_t maxVal = hasClosed ? buckets[ maxQueue[ maxHead ] % BUCKETS ].max : open.max;
+    if ( open.count > 0 )
+    {
+      minVal = open.min < minVal ? open.min : minVal;
+      maxVal = open.max > maxVal ? open.max : maxVal;
+    }
+    _stats.min = minVal;
+    _stats.max = maxVal;
+    int64_t n = static_cast< int64_t >( count );
+    _stats.meanCenti = static_cast< int32_t >( ( sum * 100 + ( sum >= 0 ? n / 2 : -n / 2 ) ) / n );
+    // n² * variance exact, then scaled in two steps to stay in 64 bit
+    int64_t varN2 = n * sumSq - sum * sum;
+    uint64_t varCenti = varN2 > 0 ? ( ( static_cast< uint64_t >( varN2 ) * 100ULL ) / count ) * 100ULL / count : 0;
+    _stats.stddevCenti = isqrt64( varCenti );
+  }
+
+  /**
+   * current bucket into the window totals; deques keep only buckets that can be min / max later
+   */
+  void RollingWindow::closeCurrent()
+  {
+    const bucket_t &bucket = buckets[ current % BUCKETS ];
+    if ( bucket.count == 0 )
+      return;
+    totCount += bucket.count;
+    totSum += bucket.sum;
+    totSumSq += bucket.sumSq;
+    while ( minLen > 0 && buckets[ minQueue[ ( minHead + minLen - 1 ) % BUCKETS ] % BUCKETS ].min >= bucket.min )
+      --minLen;
+    minQueue[ ( minHead + minLen++ ) % BUCKETS ] = current;
+    while ( maxLen > 0 && buckets[ maxQueue[ ( maxHead + maxLen - 1 ) % BUCKETS ] % BUCKETS ].max <= bucket.max )
+      --maxLen;
+    maxQueue[ ( maxHead + maxLen++ ) % BUCKETS ] = current;
+  }
+
+  /**
+   * the slot of the new current bucket holds the bucket that leaves the window
+   * (number current - BUCKETS, empty if it was never used)
+   */
+  void RollingWindow::expire()
+  {
+    uint32_t number = current - BUCKETS;
+    const bucket_t &bucket = buckets[ current % BUCKETS ];
+    totCount -= bucket.count;
+    totSum -= bucket.sum;
+    totSumSq -= bucket.sumSq;
+    if ( minLen > 0 && minQueue[ minHead ] == number )
+    {
+      minHead = ( minHead + 1 ) % BUCKETS;
+      --minLen;
+    }
+    if ( maxLen > 0 && maxQueue[ maxHead ] == number )
+    {
+      maxHead = ( maxHead + 1 ) % BUCKETS;
+      --maxLen;
+    }
+  }
+}  // namespace measure_h2o
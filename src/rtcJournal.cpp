@@ -0,0 +1,136 @@
+#include <stddef.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_rom_crc.h>
+#include "statics.hpp"
+#include "rtcJournal.hpp"
+
+namespace measure_h2o
+{
+  //
+  // one record in the journal, crc over record and seq
+  //
+  struct rtc_journal_entry_t
+  {
+    presure_data_t record;  //! the measure
+    uint32_t seq;           //! sequence number of the record
+    uint32_t crc;           //! crc32 of record and seq
+  };
+
+  //
+  // journal layout in RTC memory, the magic contains the record version
+  //
+  struct rtc_journal_t
+  {
+    uint32_t magic;                                          //! JOURNAL_MAGIC if valid
+    uint32_t writeSeq;                                       //! sequence number of the next record
+    uint32_t commitSeq;                                      //! records before are in the day file
+    uint32_t crc;                                            //! crc32 of the header fields above
+    rtc_journal_entry_t entries[ prefs::RTC_JOURNAL_SIZE ];  //! the ring
+  };
+
+  static constexpr uint32_t JOURNAL_MAGIC = 0x4a524e00U | RECORD_VERSION;
+
+  //
+  // not initialized at (soft) reset, after power on it's garbage
+  //
+  static RTC_NOINIT_ATTR rtc_journal_t journal;
+
+  const char *RtcJournal::tag{ "RtcJournal" };
+  portMUX_TYPE RtcJournal::journalMux = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t RtcJournal::replayedCount{ 0 };
+  uint32_t RtcJournal::lostCount{ 0 };
+
+  /**
+   * check the journal, valid records not committed are added to the set (oldest first)
+   * only while start, before the measure task runs
+   */
+  void RtcJournal::init( presure_data_set_t &_set )
+  {
+    esp_reset_reason_t reason = esp_reset_reason();
+    elog.log( INFO, "%s: init journal (reset reason %d)...", RtcJournal::tag, static_cast< int >( reason ) );
+    if ( reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT || journal.magic != JOURNAL_MAGIC ||
+         journal.crc != RtcJournal::headerCrc() || journal.writeSeq - journal.commitSeq > prefs::RTC_JOURNAL_SIZE )
+    {
+      elog.log( INFO, "%s: no valid journal, start empty", RtcJournal::tag );
+      RtcJournal::reset();
+      return;
+    }
+    for ( uint32_t seq = journal.commitSeq; seq != journal.writeSeq; ++seq )
+    {
+      const rtc_journal_entry_t &entry = journal.entries[ seq % prefs::RTC_JOURNAL_SIZE ];
+      uint32_t crc = esp_rom_crc32_le( 0, reinterpret_cast< const uint8_t * >( &entry ), offsetof( rtc_journal_entry_t, crc ) );
+      if ( entry.seq != seq || entry.crc != crc )
+      {
+        // torn write, the rest is not usable
+        elog.log( WARNING, "%s: journal entry <%u> damaged, stop replay", RtcJournal::tag, seq );
+        journal.writeSeq = seq;
+        break;
+      }
+      _set.push_back( entry.record );
+      ++RtcJournal::replayedCount;
+    }
+    journal.crc = RtcJournal::headerCrc();
+    elog.log( INFO, "%s: <%d> records replayed from journal", RtcJournal::tag, RtcJournal::replayedCount );
+  }
+
+  /**
+   * append a measure, first the entry, then the header
+   * if the ring is full the oldest not committed record is lost
+   */
+  void RtcJournal::append( const presure_data_t &_data )
+  {
+    portENTER_CRITICAL( &RtcJournal::journalMux );
+    rtc_journal_entry_t &entry = journal.entries[ journal.writeSeq % prefs::RTC_JOURNAL_SIZE ];
+    entry.record = _data;
+    entry.seq = journal.writeSeq;
+    entry.crc = esp_rom_crc32_le( 0, reinterpret_cast< const uint8_t * >( &entry ), offsetof( rtc_journal_entry_t, crc ) );
+    ++journal.writeSeq;
+    if ( journal.writeSeq - journal.commitSeq > prefs::RTC_JOURNAL_SIZE )
+    {
+      ++journal.commitSeq;
+      ++RtcJournal::lostCount;
+    }
+    journal.crc = RtcJournal::headerCrc();
+    portEXIT_CRITICAL( &RtcJournal::journalMux );
+  }
+
+  /**
+   * the oldest <count> records are in the day file (or dropped)
+   */
+  void RtcJournal::commit( size_t _count )
+  {
+    portENTER_CRITICAL( &RtcJournal::journalMux );
+    uint32_t pending = journal.writeSeq - journal.commitSeq;
+    journal.commitSeq += _count < pending ? static_cast< uint32_t >( _count ) : pending;
+    journal.crc = RtcJournal::headerCrc();
+    portEXIT_CRITICAL( &RtcJournal::journalMux );
+  }
+
+  /**
+   * records not committed
+   */
+  size_t RtcJournal::getPendingCount()
+  {
+    portENTER_CRITICAL( &RtcJournal::journalMux );
+    size_t pending = journal.writeSeq - journal.commitSeq;
+    portEXIT_CRITICAL( &RtcJournal::journalMux );
+    return pending;
+  }
+
+  void RtcJournal::reset()
+  {
+    journal.magic = JOURNAL_MAGIC;
+    journal.writeSeq = 0;
+    journal.commitSeq = 0;
+    journal.crc = RtcJournal::headerCrc();
+  }
+
+  /**
+   * crc over magic, writeSeq, commitSeq
+   */
+  uint32_t RtcJournal::headerCrc()
+  {
+    return esp_rom_crc32_le( 0, reinterpret_cast< const uint8_t * >( &journal ), offsetof( rtc_journal_t, crc ) );
+  }
+}  // namespace measure_h2o
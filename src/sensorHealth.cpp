@@ -0,0 +1,87 @@
+#include "sensorHealth.hpp"
+#include "intMath.hpp"
+
+namespace measure_h2o
+{
+  SensorHealth::SensorHealth( const sensor_health_params_t &_params )
+      : params( _params ),
+        state( SensorState::OK ),
+        candidate( SensorState::OK ),
+        candidateCount( 0 ),
+        lastMean( 0 ),
+        sameCount( 0 ),
+        spreadMv( 0 ),
+        noiseCentiMv( 0 ),
+        noiseAvgCentiMv( 0 ),
+        faults( 0 )
+  {
+  }
+
+  /**
+   * the single readings of one measure (before averaging)
+   */
+  bool SensorHealth::check( const uint16_t *_samples, size_t _count )
+  {
+    if ( _count == 0 )
+      return false;
+    uint32_t minMv = _samples[ 0 ];
+    uint32_t maxMv = _samples[ 0 ];
+    uint64_t sum{ 0 };
+    uint64_t sumSq{ 0 };
+    for ( size_t idx = 0; idx < _count; ++idx )
+    {
+      uint32_t mv = _samples[ idx ];
+      minMv = mv < minMv ? mv : minMv;
+      maxMv = mv > maxMv ? mv : maxMv;
+      sum += mv;
+      sumSq += static_cast< uint64_t >( mv ) * mv;
+    }
+    uint32_t mean = static_cast< uint32_t >( sum / _count );
+    // variance * n², in 0.01 mV: sd = sqrt( n * sumSq - sum² ) / n
+    uint64_t varN2 = sumSq * _count - sum * sum;
+    spreadMv = maxMv - minMv;
+    noiseCentiMv = isqrt64( varN2 * 10000ULL ) / static_cast< uint32_t >( _count );
+    noiseAvgCentiMv = noiseAvgCentiMv - ( noiseAvgCentiMv >> 3 ) + ( noiseCentiMv >> 3 );
+    sameCount = ( spreadMv == 0 && mean == lastMean ) ? sameCount + 1 : 0;
+    lastMean = mean;
+    //
+    // state of this measure, rail first (a floating input is also noisy)
+    //
+    SensorState now{ SensorState::OK };
+    if ( mean < params.openMv )
+      now = SensorState::OPEN;
+    else if ( mean > params.shortMv )
+      now = SensorState::SHORT;
+    else if ( noiseCentiMv > params.noiseMv * 100 )
+      now = SensorState::NOISY;
+    else if ( sameCount >= params.stuckCount )
+      now = SensorState::STUCK;
+    candidateCount = ( now == candidate ) ? candidateCount + 1 : 1;
+    candidate = now;
+    if ( candidate == state || candidateCount < params.confirmCount )
+      return false;
+    if ( state == SensorState::OK )
+      ++faults;
+    state = candidate;
+    return true;
+  }
+
+  const char *SensorHealth::getName( SensorState _state )
+  {
+    switch ( _state )
+    {
+      case SensorState::OK:
+        return "ok";
+      case SensorState::OPEN:
+        return "open";
+      case SensorState::SHORT:
+        return "short";
+      case SensorState::NOISY:
+        return "noisy";
+      case SensorState::STUCK:
+        return "stuck";
+      default:
+        return "unknown";
+    }
+  }
+}  // namespace measure_h2o
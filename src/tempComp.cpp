@@ -0,0 +1,64 @@
+#include "tempComp.hpp"
+
+namespace measure_h2o
+{
+  TempComp::TempComp( const temp_comp_params_t &_params )
+      : params( _params ), coeffQ16( 0 ), sumXY( 0 ), sumXX( 0 ), pairs( 0 ), lastCentiC( TEMP_UNKNOWN ), lastMv( 0 )
+  {
+  }
+
+  void TempComp::setCoefficient( int32_t _coeffQ16 )
+  {
+    if ( _coeffQ16 > params.maxCoeffQ16 )
+      _coeffQ16 = params.maxCoeffQ16;
+    else if ( _coeffQ16 < -params.maxCoeffQ16 )
+      _coeffQ16 = -params.maxCoeffQ16;
+    coeffQ16 = _coeffQ16;
+  }
+
+  /**
+   * a measure with raw tension, pairs with the measure before are used
+   * if the tension is stable (no pressure change) and the temperature changed
+   */
+  bool TempComp::learn( int16_t _centiC, uint32_t _miliVolts )
+  {
+    int16_t lastC = lastCentiC;
+    uint32_t lastV = lastMv;
+    lastCentiC = _centiC;
+    lastMv = _miliVolts;
+    if ( _centiC == TEMP_UNKNOWN || lastC == TEMP_UNKNOWN )
+      return false;
+    int64_t dT = static_cast< int64_t >( _centiC ) - lastC;
+    int64_t dMv = static_cast< int64_t >( _miliVolts ) - static_cast< int64_t >( lastV );
+    if ( dMv > static_cast< int64_t >( params.stableMv ) || -dMv > static_cast< int64_t >( params.stableMv ) )
+      return false;
+    if ( dT < params.minStepCentiC && -dT < params.minStepCentiC )
+      return false;
+    sumXY += dT * dMv;
+    sumXX += dT * dT;
+    ++pairs;
+    if ( sumXX > params.maxSumXX )
+    {
+      // forget the older half
+      sumXY /= 2;
+      sumXX /= 2;
+      pairs /= 2;
+    }
+    if ( sumXX < params.minSumXX )
+      return false;
+    setCoefficient( static_cast< int32_t >( ( sumXY * 65536LL ) / sumXX ) );
+    return true;
+  }
+
+  /**
+   * tension at the reference temperature
+   */
+  uint32_t TempComp::compensate( uint32_t _miliVolts, int16_t _centiC ) const
+  {
+    if ( _centiC == TEMP_UNKNOWN || coeffQ16 == 0 )
+      return _miliVolts;
+    int64_t correction = ( static_cast< int64_t >( coeffQ16 ) * ( _centiC - params.refCentiC ) + 0x8000LL ) >> 16;
+    int64_t miliVolts = static_cast< int64_t >( _miliVolts ) - correction;
+    return miliVolts < 0 ? 0 : static_cast< uint32_t >( miliVolts );
+  }
+}  // namespace measure_h2o
@@ -0,0 +1,134 @@
+#include <cmath>
+#include <esp_timer.h>
+#include "statics.hpp"
+#include "timeKeeper.hpp"
+#include "numFormat.hpp"
+
+namespace measure_h2o
+{
+  const char *TimeKeeper::tag{ "TimeKeeper" };
+  portMUX_TYPE TimeKeeper::timeMux = portMUX_INITIALIZER_UNLOCKED;
+  bool TimeKeeper::synced{ false };
+  int64_t TimeKeeper::offsetYs{ 0 };
+  int64_t TimeKeeper::syncMonoYs{ 0 };
+  int64_t TimeKeeper::driftBaseMonoYs{ 0 };
+  int64_t TimeKeeper::driftBaseOffsetYs{ 0 };
+  float TimeKeeper::driftPpm{ 0.0F };
+  int64_t TimeKeeper::lastErrorYs{ 0 };
+  uint32_t TimeKeeper::syncCount{ 0 };
+  uint32_t TimeKeeper::driftCount{ 0 };
+
+  /**
+   * NTP sync (from the sntp notification), new offset
+   * the change of the offset over at least TIME_MIN_DRIFT_SPAN_YS is the drift of the esp_timer
+   */
+  void TimeKeeper::onSync( const struct timeval *_tv )
+  {
+    struct timeval tv;
+    if ( _tv )
+      tv = *_tv;
+    else
+      gettimeofday( &tv, nullptr );
+    int64_t mono = esp_timer_get_time();
+    int64_t offset = static_cast< int64_t >( tv.tv_sec ) * 1000000LL + tv.tv_usec - mono;
+    bool driftUpdated{ false };
+
+    portENTER_CRITICAL( &TimeKeeper::timeMux );
+    if ( !TimeKeeper::synced )
+    {
+      TimeKeeper::driftBaseMonoYs = mono;
+      TimeKeeper::driftBaseOffsetYs = offset;
+    }
+    else
+    {
+      TimeKeeper::lastErrorYs = offset + mono - TimeKeeper::wallYs( mono );
+      int64_t span = mono - TimeKeeper::driftBaseMonoYs;
+      if ( span >= prefs::TIME_MIN_DRIFT_SPAN_YS )
+      {
+        float sample = static_cast< float >( offset - TimeKeeper::driftBaseOffsetYs ) * 1000000.0F / static_cast< float >( span );
+        // more is a time jump (e.g. other ntp server), not drift
+        if ( std::fabs( sample ) <= prefs::TIME_MAX_DRIFT_PPM )
+        {
+          if ( TimeKeeper::driftCount == 0 )
+            TimeKeeper::driftPpm = sample;
+          else
+            TimeKeeper::driftPpm += prefs::TIME_DRIFT_ALPHA * ( sample - TimeKeeper::driftPpm );
+          ++TimeKeeper::driftCount;
+          driftUpdated = true;
+        }
+        TimeKeeper::driftBaseMonoYs = mono;
+        TimeKeeper::driftBaseOffsetYs = offset;
+      }
+    }
+    TimeKeeper::offsetYs = offset;
+    TimeKeeper::syncMonoYs = mono;
+    TimeKeeper::synced = true;
+    ++TimeKeeper::syncCount;
+    portEXIT_CRITICAL( &TimeKeeper::timeMux );
+    char drift[ 16 ];
+    NumFormat::fixed( drift, sizeof( drift ), TimeKeeper::getDriftPpm(), 2 );
+    elog.log( INFO, "%s: synced, error <%d ms>, drift <%s ppm>%s", TimeKeeper::tag, TimeKeeper::getLastErrorMs(), drift,
+              driftUpdated ? "" : " (unchanged)" );
+  }
+
+  /**
+   * now, both clocks from one esp_timer read
+   */
+  time_stamp_t TimeKeeper::stamp()
+  {
+    time_stamp_t ts;
+    ts.monoYs = esp_timer_get_time();
+    ts.wallYs = TimeKeeper::toWallYs( ts.monoYs );
+    return ts;
+  }
+
+  /**
+   * monotonic time to UTC microsecounds, 0 if never synced
+   */
+  int64_t TimeKeeper::toWallYs( int64_t _monoYs )
+  {
+    portENTER_CRITICAL( &TimeKeeper::timeMux );
+    int64_t wall = TimeKeeper::synced ? TimeKeeper::wallYs( _monoYs ) : 0;
+    portEXIT_CRITICAL( &TimeKeeper::timeMux );
+    return wall;
+  }
+
+  /**
+   * UTC secounds, 0 if never synced
+   */
+  time_t TimeKeeper::now()
+  {
+    return static_cast< time_t >( TimeKeeper::toWallYs( esp_timer_get_time() ) / 1000000LL );
+  }
+
+  void TimeKeeper::toLocal( time_t _stamp, struct tm &_ti )
+  {
+    localtime_r( &_stamp, &_ti );
+  }
+
+  float TimeKeeper::getDriftPpm()
+  {
+    portENTER_CRITICAL( &TimeKeeper::timeMux );
+    float drift = TimeKeeper::driftPpm;
+    portEXIT_CRITICAL( &TimeKeeper::timeMux );
+    return drift;
+  }
+
+  int32_t TimeKeeper::getLastErrorMs()
+  {
+    portENTER_CRITICAL( &TimeKeeper::timeMux );
+    int64_t error = TimeKeeper::lastErrorYs;
+    portEXIT_CRITICAL( &TimeKeeper::timeMux );
+    return static_cast< int32_t >( error / 1000LL );
+  }
+
+  /**
+   * UTC = monotonic + offset + drift correction since the last sync (caller holds the lock)
+   */
+  int64_t TimeKeeper::wallYs( int64_t _monoYs )
+  {
+    int64_t since = _monoYs - TimeKeeper::syncMonoYs;
+    int64_t correction = static_cast< int64_t >( static_cast< float >( since ) * TimeKeeper::driftPpm / 1000000.0F );
+    return _monoYs + TimeKeeper::offsetYs + correction;
+  }
+}  // namespace measure_h2o
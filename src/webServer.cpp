@@ -1,4 +1,5 @@
 #include <memory>
+#include <algorithm>
 #include <esp_chip_info.h>
 #include <esp_spiffs.h>
 #include <cstdlib>
@@ -7,6 +8,21 @@
 #include "appPrefs.hpp"
 #include "appStati.hpp"
 #include "fileService.hpp"
+#include "dataUploader.hpp"
+#include "liveStream.hpp"
+#include "wwwAssets.hpp"
+#include "jsonWriter.hpp"
+#include "requestArena.hpp"
+#include "heapMonitor.hpp"
+#include "rtcJournal.hpp"
+#include "pressureSensor.hpp"
+#include "timeKeeper.hpp"
+#include "numFormat.hpp"
+#include "calibration.hpp"
+#include "tempComp.hpp"
+#include "anomalyMonitor.hpp"
+#include "rollingStats.hpp"
+#include "pumpMonitor.hpp"
 
 namespace measure_h2o
 {
@@ -15,78 +31,60 @@ namespace measure_h2o
   AsyncWebServer APIWebServer::server( 80 );
 
   //
-  // small html pages in GERNAM language
+  // admission control for file responses
+  // only changed in the async_tcp task (handlers, onDisconnect)
   //
-  const char intervall_html[] PROGMEM = R"rawliteral(
-  <!DOCTYPE HTML>
-  <html lang="de-DE">
-    <head>
-    <title>Messintervall</title>
-    <meta name="description" content="water pressure monitor" />
-    <meta name="keywords" content="save presure values" />
-    <meta name="author" content="Dirk Marciniak" />
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <link rel="stylesheet" href="presure.css">
-    </head>
-    <body>
-    <h1>Intervall der Messungen</h1
-    <h3>%MEASURE_INTERVAL% Sekunden</h3>
-    <br />
-    <br />
-    <div class="footnote">
-    (c) Dirk Marciniak
-    </div>
-    </body>
-  </html>
-  )rawliteral";
-
-  const char version_html[] PROGMEM = R"rawliteral(
-  <!DOCTYPE HTML>
-  <html lang="de-DE">
-    <head>
-    <title>Server Version</title>
-    <meta name="description" content="water pressure monitor" />
-    <meta name="keywords" content="save presure values" />
-    <meta name="author" content="Dirk Marciniak" />
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <link rel="stylesheet" href="presure.css">
-    </head>
-    <body>
-    <h1>Interne Versionsnummer</h1>
-    <h3>Version: %APP_VERSION%</h3>
-    <br />
-    <br />
-    <div class="footnote">
-    (c) Dirk Marciniak
-    </div>
-    </body>
-  </html>
-  )rawliteral";
-
-  const char info_html[] PROGMEM = R"rawliteral(
-  <!DOCTYPE HTML>
-  <html lang="de-DE">
-    <head>
-    <title>Server Information</title>
-    <meta name="description" content="water pressure monitor" />
-    <meta name="keywords" content="save presure values" />
-    <meta name="author" content="Dirk Marciniak" />
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <link rel="stylesheet" href="presure.css">
-    </head>
-    <body>
-    <h1>Server Informationen</h1>
-    <h3>IDF Version: %IDF_VERSION%</h3>
-    <h3>ESP Model: %ESP_MODEL%</h3>
-    <h3>CORES: %ESP_CORES%</h3>
-    <br />
-    <br />
-    <div class="footnote">
-    (c) Dirk Marciniak
-    </div>
-    </body>
-  </html>
-  )rawliteral";
+  uint32_t APIWebServer::inFlight{ 0 };
+  uint32_t APIWebServer::inFlightPeak{ 0 };
+  uint32_t APIWebServer::rejectedCount{ 0 };
+
+  //
+  // api version 1 routes, path after "/api/v1/"
+  // constant table, searched linear (only a few entrys)
+  //
+  const api_route_t APIWebServer::apiRoutes[]{
+      { "status", nullptr, ApiParam::NONE, APIWebServer::apiGetRestStatus },
+      { "today", nullptr, ApiParam::NONE, APIWebServer::apiGetTodayData },
+      { "since", nullptr, ApiParam::NONE, APIWebServer::apiGetSince },
+      { "data", "from", ApiParam::TEXT, APIWebServer::apiGetRestDataFileFrom },
+      { "interval", nullptr, ApiParam::NONE, APIWebServer::apiGetRestInterval },
+      { "fsstat", nullptr, ApiParam::NONE, APIWebServer::apiGetRestFilesystemStatus },
+      { "heap", nullptr, ApiParam::NONE, APIWebServer::apiGetRestHeapHistory },
+      { "anomalies", nullptr, ApiParam::NONE, APIWebServer::apiGetRestAnomalies },
+      { "cycles", nullptr, ApiParam::NONE, APIWebServer::apiGetRestPumpCycles },
+      { "led", nullptr, ApiParam::NONE, APIWebServer::apiGetRestLedBrightness },
+      { "flash", nullptr, ApiParam::NONE, APIWebServer::apiGetRestFlashAmount },
+      { "set-timezone", "timezone", ApiParam::TEXT, APIWebServer::apiSetTimezone },
+      { "set-timezone", "timezone-offset", ApiParam::NUMBER, APIWebServer::apiSetTimezoneOffset },
+      { "set-loglevel", "level", ApiParam::NUMBER, APIWebServer::apiSetLoglevel },
+      { "set-interval", "interval", ApiParam::NUMBER, APIWebServer::apiSetInterval },
+      { "set-led", "brightness", ApiParam::NUMBER, APIWebServer::apiSetLedBrightness },
+      { "set-upload", "url", ApiParam::TEXT, APIWebServer::apiSetUploadUrl },
+      { "set-fscheck", nullptr, ApiParam::NONE, APIWebServer::apiSetFilesystemCheck },
+      { "set-calibpoint", "mbar", ApiParam::NUMBER, APIWebServer::apiSetCalibPoint },
+      { "set-calibclear", nullptr, ApiParam::NONE, APIWebServer::apiSetCalibClear },
+      { "set-autozero", "enable", ApiParam::NUMBER, APIWebServer::apiSetAutoZero },
+      { "set-anomalyack", nullptr, ApiParam::NONE, APIWebServer::apiSetAnomalyAck } };
+
+  //
+  // content types by file suffix, first match wins
+  // This is a limited set only, for any other type always plain text
+  //
+  const content_type_t APIWebServer::contentTypes[]{ { ".pdf", "pdf", "application/pdf" },
+                                                     { ".html", "html", "text/html" },
+                                                     { ".jpeg", "jpeg", "image/jpeg" },
+                                                     { ".ico", "icon", "image/x-icon" },
+                                                     { ".json", "json", "application/json" },
+                                                     { ".jdata", "jdata", "application/json" },  // my own "raw" fileformat
+                                                     { "js.gz", "js.gz", "text/javascript" },
+                                                     { ".js", "js", "text/javascript" },
+                                                     { ".css", "css", "text/css" } };
+
+  //
+  // values for the placeholders of the html templates (templates/),
+  // they don't change while runtime, made in start() (before the first request)
+  //
+  char APIWebServer::tmplValues[ static_cast< size_t >( TmplVar::COUNT ) ][ prefs::WWW_TMPL_VALUE_LEN ]{};
 
   /**
    * ini a few things?
@@ -97,6 +95,7 @@ namespace measure_h2o
     // maybe a few things to init?
     //
     prefs::AppStati::init();
+    APIWebServer::initTemplateValues();
   }
 
   /**
@@ -105,21 +104,23 @@ namespace measure_h2o
   void APIWebServer::start()
   {
     elog.log( INFO, "%s: start webserver...", APIWebServer::tag );
+    APIWebServer::initTemplateValues();
     // reset propertys
+    LiveStream::detach();
     APIWebServer::server.reset();
-    // Cache responses for 1 minutes (60 seconds)
-    // fileroot in prefs::WEB_PATH
-    APIWebServer::server.serveStatic( "/", SPIFFS, prefs::WEB_PATH ).setCacheControl( "max-age=60" );
     //
-    // response filters
+    // live stream (SSE), before the catch all filters
+    //
+    LiveStream::attach( APIWebServer::server );
+    //
+    // response filters, plain paths (no regex)
+    // "/api/v1" matches all paths below, the route table dispatches
     //
-    APIWebServer::server.on( "^/$", HTTP_GET, APIWebServer::onIndex );
-    APIWebServer::server.on( "^/index\\.html$", HTTP_GET, APIWebServer::onIndex );
-    APIWebServer::server.on( "^/metrics$", HTTP_GET, APIWebServer::onGetMetrics );
-    APIWebServer::server.on( "^\\/api\\/v1\\/set-(.*)\?(.*)$", HTTP_GET, APIWebServer::onApiV1Set );
-    APIWebServer::server.on( "^\\/api\\/v1\\/(.*)$", HTTP_GET, APIWebServer::onApiV1 );
-    APIWebServer::server.on( "^\\/.*$", HTTP_GET, APIWebServer::onFilesReq );
-    APIWebServer::server.onNotFound( APIWebServer::onNotFound );
+    APIWebServer::server.on( "/", HTTP_GET, APIWebServer::onIndex );
+    APIWebServer::server.on( "/index.html", HTTP_GET, APIWebServer::onIndex );
+    APIWebServer::server.on( "/metrics", HTTP_GET, APIWebServer::onGetMetrics );
+    APIWebServer::server.on( prefs::API_V1_PATH, HTTP_GET, APIWebServer::onApiV1 );
+    APIWebServer::server.onNotFound( APIWebServer::onFilesReq );
     APIWebServer::server.begin();
     elog.log( DEBUG, "%s: start webserver...OK", APIWebServer::tag );
   }
@@ -129,6 +130,7 @@ namespace measure_h2o
    */
   void APIWebServer::stop()
   {
+    LiveStream::detach();
     APIWebServer::server.reset();
     APIWebServer::server.end();
   }
@@ -149,19 +151,27 @@ namespace measure_h2o
   void APIWebServer::onFilesReq( AsyncWebServerRequest *request )
   {
     prefs::AppStati::httpActive = true;
-    String file( request->url() );
+    if ( request->method() != HTTP_GET )
+    {
+      APIWebServer::onNotFound( request );
+      return;
+    }
+    // fileroot in prefs::WEB_PATH
+    String file( prefs::WEB_PATH );
+    file += request->url().substring( 1 );
     APIWebServer::deliverFileToHttpd( file, request );
   }
 
   void APIWebServer::onGetMetrics( AsyncWebServerRequest *request )
   {
-    char buffer[ 24 ];
-    size_t flash_total;
-    size_t flash_used;
-    size_t flash_free;
-
     elog.log( DEBUG, "%s: access metrics...", APIWebServer::tag );
     prefs::AppStati::httpActive = true;
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
+    {
+      APIWebServer::sendBusy( request );
+      return;
+    }
     //
     // per LINE:
     // metric_name [
@@ -171,236 +181,547 @@ namespace measure_h2o
     //
     // https://prometheus.io/docs/instrumenting/exposition_formats/
     //
-
-    //
-    // say prometheus that values are conters
-    //
-    String msg( "# TYPE pressure counter\n" );
-    // print last measured millivolts
-    snprintf( buffer, 8, "%04d\0", prefs::AppStati::getCurrentMiliVolts() );
-    msg += String( "pressure_measured_millivolts {meaning=\"millivolts\"} " ) + String( buffer ) + String( "\n" );
-    //
-    // print last measured water pressure
-    //
-    snprintf( buffer, 6, "%02.2f\0", prefs::AppStati::getCurrentPressureBar() );
-    msg += String( "pressure_measured_pressure_value {meaning=\"water pressure\"} " ) + String( buffer ) + String( "\n" );
-    //
-    // check flash memory
+    // the lines don't fit into one block, send them chunked in parts (fillMetrics)
     //
-    esp_err_t errorcode = esp_spiffs_info( prefs::WEB_PARTITION_LABEL, &flash_total, &flash_used );
-    if ( errorcode == ESP_OK )
+    arena->sendChunked( "text/plain", APIWebServer::fillMetrics );
+  }
+
+  // the largest metrics part has about 1.3 kB (with 16 digit values)
+  static_assert( prefs::ARENA_BLOCK_SIZE >= 2048, "metrics parts need blocks of 2 kB" );
+
+  /**
+   * part of the metrics, every part must fit into one block (else it is cut and logged)
+   * returns false if there are no more parts
+   */
+  bool APIWebServer::fillMetrics( RequestArena &arena, size_t part )
+  {
+    switch ( part )
     {
-      prefs::AppStati::setFsTotalSpace( flash_total );
-      prefs::AppStati::setFsUsedSpace( flash_used );
-      flash_free = flash_total - flash_used;
+      case 0:
+      {
+        //
+        // say prometheus that values are conters
+        //
+        arena.append( "# TYPE pressure counter\n" );
+        // print last measured millivolts
+        APIWebServer::appendMetric( arena, "pressure_measured_millivolts", "millivolts", prefs::AppStati::getCurrentMiliVolts(), 4 );
+        //
+        // print last measured water pressure
+        //
+        APIWebServer::appendMetricFixed( arena, "pressure_measured_pressure_value", "water pressure",
+                                         prefs::AppStati::getCurrentPressureBar(), 2 );
+        //
+        // print chip temperature and the learned compensation (mV per °C)
+        //
+        int16_t centiC = prefs::AppStati::getCurrentTemperature();
+        if ( centiC != TempComp::TEMP_UNKNOWN )
+        {
+          char temperature[ NumFormat::NUM_LEN ];
+          NumFormat::scaled( temperature, sizeof( temperature ), centiC, 2 );
+          APIWebServer::appendMetricValue( arena, "pressure_chip_temperature", "chip temperature celsius", temperature );
+        }
+        char coefficient[ NumFormat::NUM_LEN ];
+        int64_t milliCoefficient = ( static_cast< int64_t >( PrSensor::getTempCoefficient() ) * 100000LL ) >> 16;
+        NumFormat::scaled( coefficient, sizeof( coefficient ), milliCoefficient, 3 );
+        APIWebServer::appendMetricValue( arena, "pressure_temp_coefficient", "compensation millivolts per celsius", coefficient );
+        APIWebServer::appendMetric( arena, "pressure_temp_pairs", "measure pairs for the coefficient", PrSensor::getTempPairs() );
+        //
+        // print zero tracking (shift in mV)
+        //
+        char shift[ NumFormat::NUM_LEN ];
+        NumFormat::scaled( shift, sizeof( shift ), ( static_cast< int64_t >( PrSensor::getZeroShiftQ4() ) * 1000LL ) / 16, 3 );
+        APIWebServer::appendMetricValue( arena, "pressure_zero_shift_mv", "tracked zero shift millivolts", shift );
+        APIWebServer::appendMetric( arena, "pressure_zero_updates", "zero shift updates since start", PrSensor::getZeroUpdates() );
+        //
+        // print sensor health (0 ok, 1 open, 2 short, 3 noisy, 4 stuck) and the scatter of the readings
+        //
+        const SensorHealth &health = PrSensor::getHealth();
+        APIWebServer::appendMetric( arena, "pressure_sensor_health", "0 ok 1 open 2 short 3 noisy 4 stuck",
+                                    static_cast< uint32_t >( PrSensor::getHealthState() ), 1 );
+        char noise[ NumFormat::NUM_LEN ];
+        NumFormat::scaled( noise, sizeof( noise ), health.getNoiseCentiMv(), 2 );
+        APIWebServer::appendMetricValue( arena, "pressure_sensor_noise_mv", "deviation of the last readings millivolts", noise );
+        NumFormat::scaled( noise, sizeof( noise ), health.getNoiseAvgCentiMv(), 2 );
+        APIWebServer::appendMetricValue( arena, "pressure_sensor_noise_avg_mv", "average deviation millivolts", noise );
+        APIWebServer::appendMetric( arena, "pressure_sensor_spread_mv", "max - min of the last readings", health.getSpreadMv() );
+        APIWebServer::appendMetric( arena, "pressure_sensor_faults", "sensor faults since start", health.getFaults() );
+        break;
+      }
+      case 1:
+      {
+        //
+        // print anomaly detector
+        //
+        const AnomalyDetector &detector = AnomalyMonitor::getDetector();
+        APIWebServer::appendMetric( arena, "pressure_anomaly_events", "anomaly events since start", AnomalyMonitor::getEventsTotal() );
+        APIWebServer::appendMetric( arena, "pressure_anomaly_active", "anomaly not acknowledged",
+                                    static_cast< uint32_t >( AnomalyMonitor::getActive() != AnomalyType::NONE ), 1 );
+        APIWebServer::appendMetric( arena, "pressure_pump_starts", "pump starts since start", detector.getPumpStarts() );
+        APIWebServer::appendMetric( arena, "pressure_pump_starts_hour", "pump starts last hour", detector.getStartsLastHour() );
+        char rate[ NumFormat::NUM_LEN ];
+        NumFormat::scaled( rate, sizeof( rate ), ( static_cast< int64_t >( detector.getBaselineQ4() ) * 100LL ) / 16, 2 );
+        APIWebServer::appendMetricValue( arena, "pressure_quiet_decay_mbar_min", "normal decay without pump and draw", rate );
+        NumFormat::i32( rate, sizeof( rate ), detector.getNightSlope() );
+        APIWebServer::appendMetricValue( arena, "pressure_night_slope_mbar_h", "slope of the last quiet night segment", rate );
+        //
+        // print pump cycles
+        //
+        pump_cycle_t cycle;
+        APIWebServer::appendMetric( arena, "pressure_pump_cycles", "pump cycles since start", PumpMonitor::getCycles() );
+        APIWebServer::appendMetric( arena, "pressure_pump_short_cycles", "short pump cycles since start",
+                                    PumpMonitor::getShortCycles() );
+        if ( PumpMonitor::getLastCycle( cycle ) )
+        {
+          APIWebServer::appendMetric( arena, "pressure_pump_last_on_s", "on time of the last cycle", cycle.onSec, 1 );
+          APIWebServer::appendMetric( arena, "pressure_pump_last_off_s", "off time before the last cycle", cycle.offSec, 1 );
+          NumFormat::i32( rate, sizeof( rate ), cycle.rateMbarMin );
+          APIWebServer::appendMetricValue( arena, "pressure_pump_last_rate_mbar_min", "recovery rate of the last cycle", rate );
+        }
+        break;
+      }
+      case 2:
+      case 3:
+      case 4:
+      case 5:
+        //
+        // print rolling statistics (mbar), one window per part
+        //
+        APIWebServer::appendRollingStats( arena, part - 2 );
+        break;
+      case 6:
+      {
+        //
+        // check flash memory
+        //
+        size_t flash_total;
+        size_t flash_used;
+        esp_err_t errorcode = esp_spiffs_info( prefs::WEB_PARTITION_LABEL, &flash_total, &flash_used );
+        if ( errorcode == ESP_OK )
+        {
+          prefs::AppStati::setFsTotalSpace( flash_total );
+          prefs::AppStati::setFsUsedSpace( flash_used );
+        }
+        //
+        // print flash memory, free ram
+        //
+        APIWebServer::appendMetric( arena, "pressure_total_flash", "total space on flash", prefs::AppStati::getFsTotalSpace() );
+        APIWebServer::appendMetric( arena, "pressure_used_flash", "used space on flash", prefs::AppStati::getFsUsedSpace() );
+        APIWebServer::appendMetric( arena, "pressure_free_ram", "free ram on esp32", ESP.getFreeHeap() );
+        //
+        // print heap monitor
+        //
+        heap_sample_t heap;
+        if ( HeapMonitor::getSample( 0, heap ) )
+        {
+          APIWebServer::appendMetric( arena, "pressure_heap_min_free", "min free ram since start", heap.minFree );
+          APIWebServer::appendMetric( arena, "pressure_heap_max_block", "largest free block", heap.maxBlock );
+          APIWebServer::appendMetric( arena, "pressure_heap_fragmentation", "percent not in largest block", heap.fragPct );
+        }
+        APIWebServer::appendMetric( arena, "pressure_heap_level", "0 normal, 1 shed, 2 flush",
+                                    static_cast< uint32_t >( HeapMonitor::getLevel() ) );
+        APIWebServer::appendMetric( arena, "pressure_heap_shed", "times low memory", HeapMonitor::getShedCount() );
+        APIWebServer::appendMetric( arena, "pressure_heap_flush", "times very low memory", HeapMonitor::getFlushCount() );
+        //
+        // print uptime in sec
+        //
+        APIWebServer::appendMetric( arena, "pressure_uptime", "esp32 uptime secounds",
+                                    static_cast< uint32_t >( esp_timer_get_time() / 1000000LL ), 16 );
+        //
+        // print write-ahead journal (RTC memory)
+        //
+        APIWebServer::appendMetric( arena, "pressure_journal_pending", "records not in day file", RtcJournal::getPendingCount() );
+        APIWebServer::appendMetric( arena, "pressure_journal_replayed", "records replayed at boot", RtcJournal::getReplayedCount() );
+        APIWebServer::appendMetric( arena, "pressure_journal_lost", "records lost, journal full", RtcJournal::getLostCount() );
+        //
+        // print measures while time not synced
+        //
+        APIWebServer::appendMetric( arena, "pressure_offline_buffered", "measures wait for time sync", PrSensor::getOfflineCount() );
+        APIWebServer::appendMetric( arena, "pressure_offline_dropped", "measures lost, not synced", PrSensor::getOfflineDropped() );
+        break;
+      }
+      case 7:
+      {
+        //
+        // print clock state (esp_timer against NTP)
+        //
+        APIWebServer::appendMetric( arena, "pressure_time_syncs", "ntp syncs since boot", TimeKeeper::getSyncCount() );
+        APIWebServer::appendMetricFixed( arena, "pressure_time_drift_ppm", "drift esp_timer against ntp", TimeKeeper::getDriftPpm(),
+                                         3 );
+        char errorMs[ NumFormat::NUM_LEN ];
+        NumFormat::i32( errorMs, sizeof( errorMs ), TimeKeeper::getLastErrorMs() );
+        APIWebServer::appendMetricValue( arena, "pressure_time_error_ms", "clock error at last sync", errorMs );
+        //
+        // print push uploader state
+        //
+        APIWebServer::appendMetric( arena, "pressure_upload_queue", "records wait for upload", DataUploader::getQueueSize() );
+        APIWebServer::appendMetric( arena, "pressure_upload_records", "records uploaded", DataUploader::getUploadedCount() );
+        APIWebServer::appendMetric( arena, "pressure_upload_failed", "failed uploads", DataUploader::getFailedCount() );
+        APIWebServer::appendMetric( arena, "pressure_upload_dropped", "records lost for upload", DataUploader::getDroppedCount() );
+        //
+        // print live stream state
+        //
+        APIWebServer::appendMetric( arena, "pressure_live_clients", "subscribers live stream", LiveStream::getClientCount() );
+        APIWebServer::appendMetric( arena, "pressure_live_skipped", "samples skipped, slow clients", LiveStream::getSkippedCount() );
+        APIWebServer::appendMetric( arena, "pressure_ws_clients", "websocket clients", LiveStream::getWsClientCount() );
+        //
+        // print http admission control and response blocks
+        //
+        APIWebServer::appendMetric( arena, "pressure_http_in_flight", "running file responses", APIWebServer::inFlight );
+        APIWebServer::appendMetric( arena, "pressure_http_in_flight_peak", "max running file responses",
+                                    APIWebServer::inFlightPeak );
+        APIWebServer::appendMetric( arena, "pressure_http_rejected", "requests rejected, busy", APIWebServer::rejectedCount );
+        APIWebServer::appendMetric( arena, "pressure_http_arena_used", "response blocks in use", RequestArena::getUsedCount() );
+        APIWebServer::appendMetric( arena, "pressure_http_arena_peak", "max response blocks in use", RequestArena::getUsedPeak() );
+        APIWebServer::appendMetric( arena, "pressure_http_arena_exhausted", "requests without response block",
+                                    RequestArena::getExhaustedCount() );
+        break;
+      }
+      default:
+        return false;
     }
-    //
-    // print total flash memory
-    //
-    snprintf( buffer, 11, "%08d\0", prefs::AppStati::getFsTotalSpace() );
-    msg += String( "pressure_total_flash {meaning=\"total space on flash\"} " ) + String( buffer ) + String( "\n" );
-    //
-    // print used flash memory
-    //
-    snprintf( buffer, 11, "%08d\0", prefs::AppStati::getFsUsedSpace() );
-    msg += String( "pressure_used_flash {meaning=\"used space on flash\"} " ) + String( buffer ) + String( "\n" );
-    //
-    // print free ram
-    //
-    snprintf( buffer, 11, "%08d\0", ESP.getFreeHeap() );
-    msg += String( "pressure_free_ram {meaning=\"free ram on esp32\"} " ) + String( buffer ) + String( "\n" );
-    //
-    // print uptime in sec
-    //
-    int64_t uptime = static_cast< int64_t >( esp_timer_get_time() / 1000000LL );
-    snprintf( buffer, 16, "%016d\0", uptime );
-    msg += String( "pressure_uptime {meaning=\"esp32 uptime secounds\"} " ) + String( buffer ) + String( "\n" );
-    //
-    // send to client
-    //
-    request->send( 200, "text/plain", msg );
-    return;
-    // String msg = "ERROR api call v1 for <" + parameter + ">";
-    // APIWebServer::onServerError( request, 303, msg );
+    return true;
+  }
+
+  /**
+   * one metric line, value with leading zeros
+   */
+  void APIWebServer::appendMetric( RequestArena &arena, const char *name, const char *meaning, uint32_t value, uint8_t width )
+  {
+    char buffer[ NumFormat::NUM_LEN ];
+    NumFormat::u32( buffer, sizeof( buffer ), value, width );
+    APIWebServer::appendMetricValue( arena, name, meaning, buffer );
+  }
+
+  /**
+   * metric lines of one rolling statistics window, pressure_stats_<window>_<value>
+   */
+  void APIWebServer::appendRollingStats( RequestArena &arena, size_t idx )
+  {
+    rolling_stats_t stats;
+    char name[ 40 ];
+    char value[ NumFormat::NUM_LEN ];
+
+    if ( !RollingStats::get( idx, stats ) )
+      return;
+    strcpy( name, "pressure_stats_" );
+    strcat( name, RollingStats::getName( idx ) );
+    size_t prefixLen = strlen( name );
+    strcpy( name + prefixLen, "_count" );
+    APIWebServer::appendMetric( arena, name, "measures in the window", stats.count, 1 );
+    if ( stats.count == 0 )
+      return;
+    strcpy( name + prefixLen, "_min_mbar" );
+    NumFormat::i32( value, sizeof( value ), stats.min );
+    APIWebServer::appendMetricValue( arena, name, "min pressure in the window", value );
+    strcpy( name + prefixLen, "_max_mbar" );
+    NumFormat::i32( value, sizeof( value ), stats.max );
+    APIWebServer::appendMetricValue( arena, name, "max pressure in the window", value );
+    strcpy( name + prefixLen, "_mean_mbar" );
+    NumFormat::scaled( value, sizeof( value ), stats.meanCenti, 2 );
+    APIWebServer::appendMetricValue( arena, name, "mean pressure in the window", value );
+    strcpy( name + prefixLen, "_stddev_mbar" );
+    NumFormat::scaled( value, sizeof( value ), stats.stddevCenti, 2 );
+    APIWebServer::appendMetricValue( arena, name, "standard deviation in the window", value );
+  }
+
+  /**
+   * one metric line, value with decimals (NaN as "NaN")
+   */
+  void APIWebServer::appendMetricFixed( RequestArena &arena, const char *name, const char *meaning, float value, uint8_t decimals )
+  {
+    char buffer[ NumFormat::NUM_LEN ];
+    if ( NumFormat::fixed( buffer, sizeof( buffer ), value, decimals ) == 0 )
+      strcpy( buffer, "NaN" );
+    APIWebServer::appendMetricValue( arena, name, meaning, buffer );
+  }
+
+  /**
+   * one metric line, without printf
+   */
+  void APIWebServer::appendMetricValue( RequestArena &arena, const char *name, const char *meaning, const char *value )
+  {
+    arena.print( name );
+    arena.print( " {meaning=\"" );
+    arena.print( meaning );
+    arena.print( "\"} " );
+    arena.print( value );
+    arena.print( '\n' );
   }
 
   /**
    * response for an api request, Version 1
+   * find the route in the table, check the parameter and call the handler
    */
   void APIWebServer::onApiV1( AsyncWebServerRequest *request )
   {
     prefs::AppStati::httpActive = true;
-    String parameter = request->pathArg( 0 );
-    elog.log( DEBUG, "%s: api version 1 call <%s>", APIWebServer::tag, parameter );
-    if ( parameter.equals( "today" ) )
+    const char *path = request->url().c_str();
+    size_t prefixLen = strlen( prefs::API_V1_PATH );
+    const char *paramMissing{ nullptr };
+    api_arg_t arg;
+
+    if ( strncmp( path, prefs::API_V1_PATH, prefixLen ) != 0 || path[ prefixLen ] != '/' )
     {
-      APIWebServer::apiGetTodayData( request );
+      APIWebServer::onNotFound( request );
+      return;
     }
-    else if ( parameter.equals( "data" ) )
+    path += prefixLen + 1;
+    elog.log( DEBUG, "%s: api version 1 call <%s>", APIWebServer::tag, path );
+    const api_route_t *route = ApiDispatch::match( APIWebServer::apiRoutes, sizeof( APIWebServer::apiRoutes ) / sizeof( api_route_t ),
+                                                   path, APIWebServer::lookupParam, request, arg, paramMissing );
+    if ( route )
     {
-      APIWebServer::apiGetRestDataFileFrom( request );
+      route->handler( request, arg );
+      return;
     }
-    else if ( parameter.equals( "interval" ) )
+    if ( paramMissing )
     {
-      APIWebServer::apiGetRestInterval( request );
+      APIWebServer::onServerError( request, 303, "api call v1 for <%s> param <%s> not found or invalid!", path, paramMissing );
+      return;
     }
-    else if ( parameter.equals( "fsstat" ) )
+    APIWebServer::onServerError( request, 303, "ERROR api call v1 for <%s>", path );
+  }
+
+  /**
+   * value of a request parameter for the dispatcher, nullptr if not there
+   */
+  const char *APIWebServer::lookupParam( void *ctx, const char *name )
+  {
+    AsyncWebServerRequest *request = static_cast< AsyncWebServerRequest * >( ctx );
+    if ( !request->hasParam( name ) )
+      return nullptr;
+    return request->getParam( name )->value().c_str();
+  }
+
+  /**
+   * admission control for responses with file handle and buffers
+   * if too many responses running or the heap is low (now or HeapMonitor level), answer 503 and return false
+   * the slot is free if the request is gone (release of the request block)
+   */
+  bool APIWebServer::admitRequest( AsyncWebServerRequest *request )
+  {
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena || APIWebServer::inFlight >= prefs::HTTP_MAX_IN_FLIGHT || ESP.getMaxAllocHeap() < prefs::HTTP_MIN_FREE_BLOCK ||
+         HeapMonitor::shedLoad() )
     {
-      APIWebServer::apiGetRestFilesystemStatus( request );
+      ++APIWebServer::rejectedCount;
+      elog.log( WARNING, "%s: busy (%d running), reject <%s>", APIWebServer::tag, APIWebServer::inFlight, request->url().c_str() );
+      APIWebServer::sendBusy( request );
+      return false;
     }
-    else if ( parameter.equals( "led" ) )
+    ++APIWebServer::inFlight;
+    if ( APIWebServer::inFlight > APIWebServer::inFlightPeak )
+      APIWebServer::inFlightPeak = APIWebServer::inFlight;
+    arena->setOnRelease( APIWebServer::releaseRequest );
+    return true;
+  }
+
+  /**
+   * admitted request is gone
+   */
+  void APIWebServer::releaseRequest()
+  {
+    if ( APIWebServer::inFlight > 0 )
+      --APIWebServer::inFlight;
+  }
+
+  /**
+   * 503 with Retry-After, text from flash
+   */
+  void APIWebServer::sendBusy( AsyncWebServerRequest *request )
+  {
+    static const char busyMsg[] PROGMEM = "busy, try again later";
+    AsyncWebServerResponse *response =
+        request->beginResponse_P( 503, "text/plain", reinterpret_cast< const uint8_t * >( busyMsg ), sizeof( busyMsg ) - 1 );
+    response->addHeader( "Retry-After", String( prefs::HTTP_RETRY_AFTER_S ) );
+    request->send( response );
+  }
+
+  /**
+   * formatted text response, built in the request block
+   */
+  void APIWebServer::sendText( AsyncWebServerRequest *request, int code, const char *fmt, ... )
+  {
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
     {
-      APIWebServer::apiGetRestLedBrightness( request );
+      APIWebServer::sendBusy( request );
+      return;
     }
-    else if ( parameter.equals( "flash" ) )
+    va_list args;
+    va_start( args, fmt );
+    arena->vappend( fmt, args );
+    va_end( args );
+    arena->send( code, "text/plain" );
+  }
+
+  /**
+   * set the timezone (name)
+   */
+  void APIWebServer::apiSetTimezone( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    String timezone( arg.text );
+    elog.log( DEBUG, "%s: set-timezone, param: %s", APIWebServer::tag, timezone.c_str() );
+    if ( prefs::AppStati::setTimeZone( timezone ) )
     {
-      APIWebServer::apiGetRestFlashAmount( request );
+      APIWebServer::sendText( request, 200, "OK api call v1 for <set-timezone> = <%s> BUT: not functional on this chip!",
+                              timezone.c_str() );
+      setenv( "TZ", timezone.c_str(), 1 );
+      tzset();
+      // delay( 500 );
+      // ESP.restart();
+      return;
     }
-    else
+    APIWebServer::onServerError( request, 303, "ERROR api call v1 for <set-timezone> = <%s>", timezone.c_str() );
+  }
+
+  /**
+   * set the timezone offset from GMT (workarround for timezone bug)
+   */
+  void APIWebServer::apiSetTimezoneOffset( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    elog.log( DEBUG, "%s: set-timezone, param: %d", APIWebServer::tag, arg.number );
+    if ( prefs::AppStati::setTimezoneOffset( arg.number ) )
     {
-      String msg = "ERROR api call v1 for <" + parameter + ">";
-      APIWebServer::onServerError( request, 303, msg );
+      APIWebServer::sendText( request, 200, "OK api call v1 for <set-timezone> = <%d>", arg.number );
+      yield();
+      sleep( 1 );
+      ESP.restart();
+      return;
     }
+    APIWebServer::onServerError( request, 303, "ERROR api call v1 for <set-timezone> = <%d>", arg.number );
   }
 
   /**
-   * compute set commands via API
+   * set the loglevel of the app
    */
-  void APIWebServer::onApiV1Set( AsyncWebServerRequest *request )
+  void APIWebServer::apiSetLoglevel( AsyncWebServerRequest *request, const api_arg_t &arg )
   {
-    prefs::AppStati::httpActive = true;
-    String verb = request->pathArg( 0 );
-    String server, port;
+    elog.log( DEBUG, "%s: set-loglevel, param: %d", APIWebServer::tag, arg.number );
+    uint8_t numLevel = static_cast< uint8_t >( arg.number );
+    prefs::AppStati::setLogLevel( numLevel );
+    APIWebServer::sendText( request, 200, "OK api call v1 for <set-loglevel>" );
+    yield();
+    sleep( 1 );
+    ESP.restart();
+  }
 
-    elog.log( DEBUG, "%s: api version 1 call set-%s", APIWebServer::tag, verb );
-    //
-    // timezone set?
-    //
-    if ( verb.equals( "timezone" ) )
-    {
-      // timezone parameter find
-      if ( request->hasParam( "timezone" ) )
-      {
-        String timezone = request->getParam( "timezone" )->value();
-        elog.log( DEBUG, "%s: set-timezone, param: %s", APIWebServer::tag, timezone.c_str() );
-        if ( prefs::AppStati::setTimeZone( timezone ) )
-        {
-          request->send( 200, "text/plain",
-                         "OK api call v1 for <set-" + verb + "> = <" + timezone + "> BUT: not functional on this chip!" );
-          setenv( "TZ", timezone.c_str(), 1 );
-          tzset();
-          // delay( 500 );
-          // ESP.restart();
-        }
-        else
-        {
-          String msg = "ERROR api call v1 for <set-" + verb + "> = <" + timezone + ">";
-          APIWebServer::onServerError( request, 303, msg );
-        }
-        return;
-      }
-      // timezone offset parameter find
-      else if ( request->hasParam( "timezone-offset" ) )
-      {
-        String timezone = request->getParam( "timezone-offset" )->value();
-        elog.log( DEBUG, "%s: set-%s, param: %s", APIWebServer::tag, verb.c_str(), timezone.c_str() );
-        if ( prefs::AppStati::setTimezoneOffset( timezone.toInt() ) )
-        {
-          request->send( 200, "text/plain", "OK api call v1 for <set-" + verb + "> = <" + timezone + ">" );
-          yield();
-          sleep( 1 );
-          ESP.restart();
-        }
-        else
-        {
-          String msg = "ERROR api call v1 for <set-" + verb + "> = <" + timezone + ">";
-          APIWebServer::onServerError( request, 303, msg );
-        }
-        return;
-      }
-      else
-      {
-        String msg = "api call v1 for <set-" + verb + "> param not found!";
-        APIWebServer::onServerError( request, 303, msg );
-        return;
-      }
-    }
-    else if ( verb.equals( "loglevel" ) )
-    {
-      // loglevel parameter find
-      if ( request->hasParam( "level" ) )
-      {
-        String level = request->getParam( "level" )->value();
-        elog.log( DEBUG, "%s: set-loglevel, param: %s", APIWebServer::tag, level.c_str() );
-        uint8_t numLevel = static_cast< uint8_t >( level.toInt() );
-        prefs::AppStati::setLogLevel( numLevel );
-        request->send( 200, "text/plain", "OK api call v1 for <set-" + verb + ">" );
-        yield();
-        sleep( 1 );
-        ESP.restart();
-        return;
-      }
-      else
-      {
-        String msg = "api call v1 for <set-" + verb + "> param not found!";
-        APIWebServer::onServerError( request, 303, msg );
-        return;
-      }
-    }
-    else if ( verb.equals( "interval" ) )
+  /**
+   * set the measure interval, deletes the today file
+   */
+  void APIWebServer::apiSetInterval( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    elog.log( DEBUG, "%s: set-interval, param: %d", APIWebServer::tag, arg.number );
+    uint32_t numLevel = static_cast< uint32_t >( arg.number );
+    if ( prefs::AppStati::setMeasureInterval_s( numLevel ) )
     {
-      String interval = request->getParam( "interval" )->value();
-      elog.log( DEBUG, "%s: set-interval, param: %s", APIWebServer::tag, interval.c_str() );
-      uint32_t numLevel = static_cast< uint32_t >( interval.toInt() );
-      if ( prefs::AppStati::setMeasureInterval_s( numLevel ) )
-      {
-        FileService::deleteTodayFile();
-        request->send( 200, "text/plain", "OK api call v1 for <set-" + verb + ">" );
-        yield();
-        sleep( 1 );
-        ESP.restart();
-      }
+      FileService::deleteTodayFile();
+      APIWebServer::sendText( request, 200, "OK api call v1 for <set-interval>" );
+      yield();
+      sleep( 1 );
+      ESP.restart();
       return;
     }
-    else if ( verb.equals( "led" ) )
+    APIWebServer::sendText( request, 300, "fail api call v1 for <set-interval>" );
+  }
+
+  /**
+   * set the led stripe brightness
+   */
+  void APIWebServer::apiSetLedBrightness( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    elog.log( DEBUG, "%s: set-led, param: %d", APIWebServer::tag, arg.number );
+    uint8_t br = static_cast< uint8_t >( arg.number & 0xff );
+    if ( prefs::AppStati::setLedBrightness( br ) )
     {
-      if ( request->hasParam( "brightness" ) )
-      {
-        String brightness = request->getParam( "brightness" )->value();
-        elog.log( DEBUG, "%s: set-%s, param: %s", APIWebServer::tag, verb, brightness.c_str() );
-        uint8_t br = static_cast< uint8_t >( brightness.toInt() & 0xff );
-        if ( prefs::AppStati::setLedBrightness( br ) )
-        {
-          request->send( 200, "text/plain", "OK api call v1 for <set-" + verb + ">" );
-          yield();
-          sleep( 1 );
-          ESP.restart();
-          return;
-        }
-        else
-        {
-          request->send( 300, "text/plain", "fail api call v1 for <set-" + verb + ">" );
-          return;
-        }
-      }
+      APIWebServer::sendText( request, 200, "OK api call v1 for <set-led>" );
+      yield();
+      sleep( 1 );
+      ESP.restart();
+      return;
     }
-    else if ( verb.equals( "fscheck" ) )
+    APIWebServer::sendText( request, 300, "fail api call v1 for <set-led>" );
+  }
+
+  /**
+   * set the url for push uploads, empty url disables the push uploads
+   */
+  void APIWebServer::apiSetUploadUrl( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    String url( arg.text );
+    elog.log( DEBUG, "%s: set-upload, param: %s", APIWebServer::tag, url.c_str() );
+    if ( prefs::AppStati::setUploadUrl( url ) )
     {
-      elog.log( DEBUG, "%s: set-%s, init force filesystemcheck", APIWebServer::tag, verb );
-      prefs::AppStati::setForceFilesystemCheck( true );
-      request->send( 200, "text/plain", "OK api call v1 for <set-" + verb + ">" );
+      APIWebServer::sendText( request, 200, "OK api call v1 for <set-upload>" );
+      yield();
+      sleep( 1 );
+      ESP.restart();
       return;
     }
-    else
+    APIWebServer::sendText( request, 300, "fail api call v1 for <set-upload>" );
+  }
+
+  /**
+   * force a filesystem check
+   */
+  void APIWebServer::apiSetFilesystemCheck( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    elog.log( DEBUG, "%s: set-fscheck, init force filesystemcheck", APIWebServer::tag );
+    prefs::AppStati::setForceFilesystemCheck( true );
+    APIWebServer::sendText( request, 200, "OK api call v1 for <set-fscheck>" );
+  }
+
+  /**
+   * take a point of the calibration curve, the reference pressure (mbar) must be on the sensor
+   * the measure task takes the point in the next secound (result in status)
+   */
+  void APIWebServer::apiSetCalibPoint( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    elog.log( DEBUG, "%s: set-calibpoint, param: %d", APIWebServer::tag, arg.number );
+    int32_t value = arg.number;
+    if ( value < 0 || value > prefs::PRESSURE_MAX_MBAR )
     {
-      request->send( 300, "text/plain", "fail api call v1 for <set-" + verb + ">" );
+      APIWebServer::sendText( request, 300, "fail api call v1 for <set-calibpoint>, mbar 0..%d", prefs::PRESSURE_MAX_MBAR );
       return;
     }
+    PrSensor::requestCalibPoint( value );
+    APIWebServer::sendText( request, 202, "OK api call v1 for <set-calibpoint>, see calibration in status" );
   }
+
+  /**
+   * remove the calibration curve (zero point and factor again)
+   */
+  void APIWebServer::apiSetCalibClear( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    elog.log( DEBUG, "%s: set-calibclear", APIWebServer::tag );
+    Calibration::clear();
+    APIWebServer::sendText( request, 200, "OK api call v1 for <set-calibclear>" );
+  }
+
+  /**
+   * switch the zero tracking (idle times move the zero point), 0 == off and shift removed
+   */
+  void APIWebServer::apiSetAutoZero( AsyncWebServerRequest *request, const api_arg_t &arg )
+  {
+    elog.log( DEBUG, "%s: set-autozero, param: %d", APIWebServer::tag, arg.number );
+    PrSensor::setAutoZero( arg.number != 0 );
+    APIWebServer::sendText( request, 200, "OK api call v1 for <set-autozero>" );
+  }
+
+  /**
+   * the anomaly was seen, LCD and LED normal again (events stay in the ring)
+   */
+  void APIWebServer::apiSetAnomalyAck( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    elog.log( DEBUG, "%s: set-anomalyack", APIWebServer::tag );
+    AnomalyMonitor::acknowledge();
+    APIWebServer::sendText( request, 200, "OK api call v1 for <set-anomalyack>" );
+  }
+
   /**
    * request for environment data for today
    */
-  void APIWebServer::apiGetTodayData( AsyncWebServerRequest *request )
+  void APIWebServer::apiGetTodayData( AsyncWebServerRequest *request, const api_arg_t & )
   {
     elog.log( DEBUG, "%s: getTodayData...", APIWebServer::tag );
     String &fileName = FileService::getTodayFileName();
@@ -409,27 +730,75 @@ namespace measure_h2o
     //
     if ( xSemaphoreTake( FileService::measureFileSem, pdMS_TO_TICKS( 1500 ) ) == pdTRUE )
     {
-      APIWebServer::deliverFileToHttpd( fileName, request );
+      APIWebServer::deliverDataFile( fileName, request );
       xSemaphoreGive( FileService::measureFileSem );
       return;
     }
-    String msg = "Can't take semaphore!";
-    elog.log( CRITICAL, "%s: %s", APIWebServer::tag, msg );
-    APIWebServer::onServerError( request, 303, msg );
+    elog.log( CRITICAL, "%s: can't take semaphore for today file!", APIWebServer::tag );
+    APIWebServer::onServerError( request, 303, "Can't take semaphore!" );
+  }
+
+  /**
+   * records after a cursor "YYYYMMDD-offset" (day file, byte offset), over day boundaries
+   * without cursor from the oldest day file, the next cursor is in header X-Next-Cursor
+   */
+  void APIWebServer::apiGetSince( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    time_t day{ 0 };
+    size_t offset{ 0 };
+    char cursor[ 24 ];
+
+    if ( request->hasParam( "cursor" ) )
+    {
+      struct tm ti = {};
+      unsigned long off{ 0 };
+      if ( sscanf( request->getParam( "cursor" )->value().c_str(), "%4d%2d%2d-%lu", &ti.tm_year, &ti.tm_mon, &ti.tm_mday, &off ) != 4 )
+      {
+        APIWebServer::onServerError( request, 303, "api call v1 for <since> cursor invalid!" );
+        return;
+      }
+      ti.tm_year -= 1900;
+      ti.tm_mon -= 1;
+      ti.tm_isdst = -1;
+      day = mktime( &ti );
+      offset = off;
+    }
+    //
+    // not older than the oldest possible day file
+    //
+    time_t oldest = FileService::getDayStart( TimeKeeper::now() - prefs::MAX_DATA_FILE_AGE_SEC );
+    if ( day < oldest )
+    {
+      day = oldest;
+      offset = 0;
+    }
+    if ( !APIWebServer::admitRequest( request ) )
+      return;
+    AsyncResponseStream *response = request->beginResponseStream( "text/csv" );
+    bool more = FileService::readSince( day, offset, *response, prefs::SINCE_MAX_BYTES );
+    struct tm ti;
+    localtime_r( &day, &ti );
+    snprintf( cursor, sizeof( cursor ), "%04d%02d%02d-%lu", ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday,
+              static_cast< unsigned long >( offset ) );
+    elog.log( DEBUG, "%s: since, next cursor <%s>", APIWebServer::tag, cursor );
+    response->addHeader( "X-Next-Cursor", cursor );
+    response->addHeader( "X-More", more ? "1" : "0" );
+    response->addHeader( "Cache-Control", "no-cache" );
+    request->send( response );
   }
 
   /**
    * get Datafile from date, if availible
    */
-  void APIWebServer::apiGetRestDataFileFrom( AsyncWebServerRequest *request )
+  void APIWebServer::apiGetRestDataFileFrom( AsyncWebServerRequest *request, const api_arg_t &arg )
   {
     elog.log( DEBUG, "%s: apiGetRestDataFileFrom...", APIWebServer::tag );
-    if ( request->hasParam( "from" ) )
+    if ( arg.text )
     {
-      String dateNameStr = request->getParam( "from" )->value().substring( 0, 10 );
+      String dateNameStr = String( arg.text ).substring( 0, 10 );
       String fileName( prefs::DATA_PATH );
       fileName += dateNameStr;
-      fileName += "-pressure.csv";
+      fileName += prefs::DAYLY_FILE_SUFFIX;
       elog.log( DEBUG, "%s: apiGetRestDataFileFrom try to deliver <%s>...", APIWebServer::tag, fileName.c_str() );
       if ( SPIFFS.exists( fileName ) )
       {
@@ -438,57 +807,46 @@ namespace measure_h2o
         //
         if ( xSemaphoreTake( FileService::measureFileSem, pdMS_TO_TICKS( 1500 ) ) == pdTRUE )
         {
-          APIWebServer::deliverFileToHttpd( fileName, request );
+          APIWebServer::deliverDataFile( fileName, request );
           xSemaphoreGive( FileService::measureFileSem );
           return;
         }
-        String msg = "Can't take semaphore!";
-        APIWebServer::onServerError( request, 303, msg );
+        APIWebServer::onServerError( request, 303, "Can't take semaphore!" );
         return;
       }
-      String msg = "File <";
-      msg += fileName.substring( 6 );
-      msg += "> don't exist!";
-      APIWebServer::onServerError( request, 303, msg );
+      APIWebServer::onServerError( request, 303, "File <%s> don't exist!", fileName.c_str() + strlen( prefs::DATA_PATH ) );
       return;
     }
     else
     {
-      String msg = "no param <from> sent!";
-      APIWebServer::onServerError( request, 303, msg );
+      APIWebServer::onServerError( request, 303, "no param <from> sent!" );
     }
   }
 
   /**
    * get the led stripe brightness
    */
-  void APIWebServer::apiGetRestLedBrightness( AsyncWebServerRequest *request )
+  void APIWebServer::apiGetRestLedBrightness( AsyncWebServerRequest *request, const api_arg_t & )
   {
     uint8_t br = prefs::AppStati::getLedBrightness();
     elog.log( DEBUG, "%s: apiGetRestLedBrightness (%03d)...", APIWebServer::tag, br );
-    char buffer[ 18 ];
-    snprintf( buffer, 18, "BRIGHTNESS: %03d", static_cast< int >( br ) );
-    request->send( 200, "text/plain", buffer );
-    return;
+    APIWebServer::sendText( request, 200, "BRIGHTNESS: %03d", static_cast< int >( br ) );
   }
 
   /**
    * get measure interval from server
    */
-  void APIWebServer::apiGetRestInterval( AsyncWebServerRequest *request )
+  void APIWebServer::apiGetRestInterval( AsyncWebServerRequest *request, const api_arg_t & )
   {
     uint32_t interval = prefs::AppStati::getMeasureInterval_s();
     elog.log( DEBUG, "%s: apiGetRestInterval (%03d)...", APIWebServer::tag, interval );
-    char buffer[ 15 ];
-    snprintf( buffer, 15, "INTERVAL: %03d", static_cast< int >( interval ) );
-    request->send( 200, "text/plain", buffer );
-    return;
+    APIWebServer::sendText( request, 200, "INTERVAL: %03d", static_cast< int >( interval ) );
   }
 
   /**
    * get current flash amounts
    */
-  void APIWebServer::apiGetRestFlashAmount( AsyncWebServerRequest *request )
+  void APIWebServer::apiGetRestFlashAmount( AsyncWebServerRequest *request, const api_arg_t & )
   {
     elog.log( DEBUG, "%s: get file infos...", APIWebServer::tag );
     size_t flash_total;
@@ -500,48 +858,304 @@ namespace measure_h2o
     {
       flash_free = flash_total - flash_used;
       elog.log( DEBUG, "%s: SPIFFS total %07d, used %07d, free %07d", APIWebServer::tag, flash_total, flash_used, flash_free );
-      char buffer[ 128 ];
-      snprintf( buffer, 128, "SPIFFS total %07d, used %07d, free %07d, min-free: %07d", flash_total, flash_used, flash_free,
-                prefs::MIN_FILE_SYSTEM_FREE_SIZE );
-      request->send( 200, "text/plain", buffer );
+      APIWebServer::sendText( request, 200, "SPIFFS total %07d, used %07d, free %07d, min-free: %07d", flash_total, flash_used,
+                              flash_free, prefs::MIN_FILE_SYSTEM_FREE_SIZE );
     }
     else
     {
-      request->send( 300, "text/plain", "error while chcek spiffs space" );
-    }
-  }
-
-  void APIWebServer::apiGetRestFilesystemStatus( AsyncWebServerRequest *request )
-  {
-    // elog.log( DEBUG, "%s: request filesystem status...", APIWebServer::tag );
-    // cJSON *root = cJSON_CreateObject();
-    // // total
-    // String val = String( StatusObject::getFsTotalSpace(), DEC );
-    // cJSON_AddStringToObject( root, "total", val.c_str() );
-    // // used space
-    // val = String( StatusObject::getFsUsedSpace() );
-    // cJSON_AddStringToObject( root, "used", val.c_str() );
-    // // dayly file
-    // val = String( StatusObject::getTodayFilseSize() );
-    // cJSON_AddStringToObject( root, "today", val.c_str() );
-    // // weekly
-    // val = String( StatusObject::getWeekFilseSize() );
-    // cJSON_AddStringToObject( root, "week", val.c_str() );
-    // // month
-    // val = String( StatusObject::getMonthFilseSize() );
-    // cJSON_AddStringToObject( root, "month", val.c_str() );
-    // // weekly
-    // val = String( StatusObject::getAckuFilseSize() );
-    // cJSON_AddStringToObject( root, "acku", val.c_str() );
-    // char *tmp_info = cJSON_PrintUnformatted( root );  // cJSON_Print(root);
-    // String info( tmp_info );
-    // request->send( 200, "application/json", info );
-    // cJSON_Delete( root );
-    // cJSON_free( tmp_info );  //!!!! important, memory leak
-    // elog.log( DEBUG, "%s: request filesystem status...OK", APIWebServer::tag );
-    // TODO: implement in html
-    String msg = "not implemented (yet)!";
-    APIWebServer::onServerError( request, 303, msg );
+      APIWebServer::sendText( request, 300, "error while chcek spiffs space" );
+    }
+  }
+
+  /**
+   * filesystem overview as json (flash and day files)
+   */
+  void APIWebServer::apiGetRestFilesystemStatus( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    elog.log( DEBUG, "%s: request filesystem status...", APIWebServer::tag );
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
+    {
+      APIWebServer::sendBusy( request );
+      return;
+    }
+    JsonWriter json( *arena );
+    json.beginObject();
+    APIWebServer::writeFilesystemStatus( json );
+    json.endObject();
+    arena->send( 200, "application/json" );
+  }
+
+  /**
+   * all states of the device in one json document
+   */
+  void APIWebServer::apiGetRestStatus( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    elog.log( DEBUG, "%s: request status...", APIWebServer::tag );
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
+    {
+      APIWebServer::sendBusy( request );
+      return;
+    }
+    JsonWriter json( *arena );
+    json.beginObject();
+    json.add( "version", prefs::VERSION );
+    json.add( "hostname", prefs::AppStati::getHostName().c_str() );
+    json.add( "uptime", static_cast< uint32_t >( esp_timer_get_time() / 1000000LL ) );
+    json.add( "time", static_cast< uint32_t >( TimeKeeper::now() ) );
+    json.add( "interval", prefs::AppStati::getMeasureInterval_s() );
+    json.beginObject( "pressure" );
+    json.add( "bar", prefs::AppStati::getCurrentPressureBar() );
+    json.add( "millivolts", prefs::AppStati::getCurrentMiliVolts() );
+    if ( prefs::AppStati::getCurrentTemperature() != TempComp::TEMP_UNKNOWN )
+      json.add( "temperature", static_cast< float >( prefs::AppStati::getCurrentTemperature() ) / 100.0F );
+    json.add( "tempCoefficientQ16", PrSensor::getTempCoefficient() );
+    json.add( "health", SensorHealth::getName( PrSensor::getHealthState() ) );
+    json.add( "noiseMv", static_cast< float >( PrSensor::getHealth().getNoiseCentiMv() ) / 100.0F );
+    json.endObject();
+    json.beginObject( "stats" );
+    for ( size_t idx = 0; idx < prefs::STATS_WINDOW_COUNT; ++idx )
+    {
+      rolling_stats_t stats;
+      if ( !RollingStats::get( idx, stats ) )
+        continue;
+      json.beginObject( RollingStats::getName( idx ) );
+      json.add( "count", stats.count );
+      if ( stats.count > 0 )
+      {
+        json.add( "min", stats.min );
+        json.add( "max", stats.max );
+        json.add( "mean", static_cast< float >( stats.meanCenti ) / 100.0F );
+        json.add( "stddev", static_cast< float >( stats.stddevCenti ) / 100.0F );
+      }
+      json.endObject();
+    }
+    json.endObject();
+    json.beginObject( "calibration" );
+    json.add( "min", prefs::AppStati::getCalibreMinVal() );
+    json.add( "max", prefs::AppStati::getCalibreMaxVal() );
+    json.add( "factor", prefs::AppStati::getCalibreFactor(), 5 );
+    json.add( "factorQ16", prefs::AppStati::getCalibreFactorQ16() );
+    calib_point_t points[ prefs::CALIB_MAX_POINTS ];
+    size_t pointCount = Calibration::getPoints( points );
+    json.beginArray( "points" );
+    for ( size_t idx = 0; idx < pointCount; ++idx )
+    {
+      json.beginObject();
+      json.add( "mv", static_cast< uint32_t >( points[ idx ].miliVolts ) );
+      json.add( "mbar", static_cast< int32_t >( points[ idx ].mbar ) );
+      json.endObject();
+    }
+    json.endArray();
+    json.add( "autoZero", PrSensor::getAutoZero() );
+    json.add( "zeroShiftQ4", PrSensor::getZeroShiftQ4() );
+    json.endObject();
+    json.beginObject( "wlan" );
+    json.add( "state", APIWebServer::getWlanStateName( prefs::AppStati::getWlanState() ) );
+    json.add( "rssi", static_cast< int32_t >( WiFi.RSSI() ) );
+    json.add( "ip", WiFi.localIP().toString().c_str() );
+    json.endObject();
+    json.beginObject( "clock" );
+    json.add( "synced", TimeKeeper::isSynced() );
+    json.add( "syncs", TimeKeeper::getSyncCount() );
+    json.add( "driftPpm", TimeKeeper::getDriftPpm(), 3 );
+    json.add( "lastErrorMs", TimeKeeper::getLastErrorMs() );
+    json.endObject();
+    json.beginObject( "heap" );
+    json.add( "free", static_cast< uint32_t >( ESP.getFreeHeap() ) );
+    json.add( "min", static_cast< uint32_t >( ESP.getMinFreeHeap() ) );
+    json.add( "maxBlock", static_cast< uint32_t >( ESP.getMaxAllocHeap() ) );
+    json.add( "level", HeapMonitor::getLevelName( HeapMonitor::getLevel() ) );
+    json.add( "shed", HeapMonitor::getShedCount() );
+    json.add( "flush", HeapMonitor::getFlushCount() );
+    json.endObject();
+    APIWebServer::writeFilesystemStatus( json );
+    json.endObject();
+    arena->send( 200, "application/json" );
+  }
+
+  /**
+   * heap monitor samples as json, oldest first
+   * samples: [uptime, free, minFree, maxBlock, fragmentation %]
+   */
+  void APIWebServer::apiGetRestHeapHistory( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    heap_sample_t sample;
+
+    elog.log( DEBUG, "%s: request heap history...", APIWebServer::tag );
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
+    {
+      APIWebServer::sendBusy( request );
+      return;
+    }
+    JsonWriter json( *arena );
+    json.beginObject();
+    json.add( "interval", static_cast< uint32_t >( prefs::HEAP_SAMPLE_YS / 1000000LL ) );
+    json.add( "level", HeapMonitor::getLevelName( HeapMonitor::getLevel() ) );
+    json.beginArray( "samples" );
+    for ( size_t age = HeapMonitor::getSampleCount(); age > 0; --age )
+    {
+      if ( !HeapMonitor::getSample( age - 1, sample ) )
+        continue;
+      json.beginArray();
+      json.add( nullptr, sample.uptime );
+      json.add( nullptr, sample.free );
+      json.add( nullptr, sample.minFree );
+      json.add( nullptr, sample.maxBlock );
+      json.add( nullptr, static_cast< uint32_t >( sample.fragPct ) );
+      json.endArray();
+    }
+    json.endArray();
+    json.endObject();
+    arena->send( 200, "application/json" );
+  }
+
+  /**
+   * anomaly events (newest first) and the state of the detector
+   */
+  void APIWebServer::apiGetRestAnomalies( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    anomaly_event_t event;
+
+    elog.log( DEBUG, "%s: request anomalies...", APIWebServer::tag );
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
+    {
+      APIWebServer::sendBusy( request );
+      return;
+    }
+    const AnomalyDetector &detector = AnomalyMonitor::getDetector();
+    JsonWriter json( *arena );
+    json.beginObject();
+    json.add( "active", AnomalyDetector::getName( AnomalyMonitor::getActive() ) );
+    json.add( "total", AnomalyMonitor::getEventsTotal() );
+    json.add( "pumpStarts", detector.getPumpStarts() );
+    json.add( "pumpStartsHour", detector.getStartsLastHour() );
+    json.add( "nightSlopeMbarH", detector.getNightSlope() );
+    json.add( "quietDecayMbarMin", static_cast< float >( detector.getBaselineQ4() ) / 16.0F );
+    json.add( "cusum", static_cast< float >( detector.getCusumQ4() ) / 16.0F );
+    json.beginArray( "events" );
+    for ( size_t age = 0; age < AnomalyMonitor::getEventCount(); ++age )
+    {
+      if ( !AnomalyMonitor::getEvent( age, event ) )
+        continue;
+      json.beginObject();
+      json.add( "time", event.timestamp );
+      json.add( "type", AnomalyDetector::getName( event.type ) );
+      json.add( "value", event.value );
+      json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    arena->send( 200, "application/json" );
+  }
+
+  // json of one cycle has max 122 bytes, the counters max 89, all in one response block
+  static_assert( prefs::PUMP_API_RECORDS * 128 + 128 <= prefs::ARENA_BLOCK_SIZE, "cycles json too large for the response block" );
+
+  /**
+   * pump cycle counters and the newest records of the cycle log (newest first)
+   */
+  void APIWebServer::apiGetRestPumpCycles( AsyncWebServerRequest *request, const api_arg_t & )
+  {
+    pump_cycle_t cycles[ prefs::PUMP_API_RECORDS ];
+
+    elog.log( DEBUG, "%s: request pump cycles...", APIWebServer::tag );
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
+    {
+      APIWebServer::sendBusy( request );
+      return;
+    }
+    size_t count = PumpMonitor::readLast( cycles, prefs::PUMP_API_RECORDS );
+    JsonWriter json( *arena );
+    json.beginObject();
+    json.add( "pumpOn", PumpMonitor::isOn() );
+    json.add( "total", PumpMonitor::getCycles() );
+    json.add( "short", PumpMonitor::getShortCycles() );
+    json.add( "logErrors", PumpMonitor::getLogErrors() );
+    json.beginArray( "cycles" );
+    for ( size_t idx = count; idx > 0; --idx )
+    {
+      const pump_cycle_t &cycle = cycles[ idx - 1 ];
+      json.beginObject();
+      json.add( "start", cycle.start );
+      json.add( "onSec", static_cast< uint32_t >( cycle.onSec ) );
+      if ( cycle.offSec != PUMP_OFF_UNKNOWN )
+        json.add( "offSec", static_cast< uint32_t >( cycle.offSec ) );
+      json.add( "startMbar", static_cast< int32_t >( cycle.startMbar ) );
+      json.add( "peakMbar", static_cast< int32_t >( cycle.peakMbar ) );
+      json.add( "rateMbarMin", static_cast< int32_t >( cycle.rateMbarMin ) );
+      json.add( "short", ( cycle.flags & PUMP_CYCLE_SHORT ) != 0 );
+      json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    arena->send( 200, "application/json" );
+  }
+
+  /**
+   * flash amounts and the day files with sizes
+   */
+  void APIWebServer::writeFilesystemStatus( JsonWriter &json )
+  {
+    size_t flash_total{ 0 };
+    size_t flash_used{ 0 };
+
+    json.beginObject( "flash" );
+    if ( esp_spiffs_info( prefs::WEB_PARTITION_LABEL, &flash_total, &flash_used ) == ESP_OK )
+    {
+      json.add( "total", static_cast< uint32_t >( flash_total ) );
+      json.add( "used", static_cast< uint32_t >( flash_used ) );
+      json.add( "free", static_cast< uint32_t >( flash_total - flash_used ) );
+    }
+    json.add( "minFree", static_cast< uint32_t >( prefs::MIN_FILE_SYSTEM_FREE_SIZE ) );
+    json.endObject();
+    json.beginArray( "files" );
+    if ( prefs::AppStati::getIsSpiffsInit() )
+    {
+      File root = SPIFFS.open( String( prefs::DATA_PATH ).substring( 0, strlen( prefs::DATA_PATH ) - 1 ) );
+      File fh = root.openNextFile();
+      while ( fh )
+      {
+        if ( FileService::isDayFileName( fh.path() ) )
+        {
+          json.beginObject();
+          json.add( "name", fh.name() );
+          json.add( "size", static_cast< uint32_t >( fh.size() ) );
+          json.endObject();
+        }
+        fh.close();
+        fh = root.openNextFile();
+      }
+      root.close();
+    }
+    json.endArray();
+  }
+
+  /**
+   * name of the WLAN state for json
+   */
+  const char *APIWebServer::getWlanStateName( WlanState _state )
+  {
+    switch ( _state )
+    {
+      case WlanState::DISCONNECTED:
+        return "DISCONNECTED";
+      case WlanState::SEARCHING:
+        return "SEARCHING";
+      case WlanState::CONNECTED:
+        return "CONNECTED";
+      case WlanState::TIMESYNCED:
+        return "TIMESYNCED";
+      case WlanState::CONFIGPORTAL:
+        return "CONFIGPORTAL";
+      case WlanState::FAILED:
+      default:
+        return "FAILED";
+    }
   }
 
   /**
@@ -552,22 +1166,38 @@ namespace measure_h2o
     String contentType( "text/plain" );
     String contentTypeMarker{ 0 };
 
+    //
+    // web files and templates, compiled into the firmware
+    //
+    for ( const www_asset_t &asset : WWW_ASSETS )
+    {
+      if ( filePath.equals( asset.path ) )
+      {
+        APIWebServer::deliverWwwAsset( asset, request );
+        return;
+      }
+    }
+    for ( const www_template_t &tmpl : WWW_TEMPLATES )
+    {
+      if ( filePath.equals( tmpl.path ) )
+      {
+        APIWebServer::deliverTemplate( tmpl, request );
+        return;
+      }
+    }
     if ( !prefs::AppStati::getIsSpiffsInit() )
     {
       elog.log( WARNING, "%s: SPIFFS not initialized, send file ABORT!", APIWebServer::tag );
-      request->send( 500, "text/plain", "SPIFFS not initialized" );
+      APIWebServer::sendText( request, 500, "SPIFFS not initialized" );
       return;
     }
-    //
-    // next check if filename not exits
-    // do this after file check, so i can overwrite this
-    // behavior if an file is exist
-    //
     if ( !SPIFFS.exists( filePath ) )
     {
-      APIWebServer::handleNotPhysicFileSources( filePath, request );
+      APIWebServer::onNotFound( request );
       return;
     }
+    if ( !APIWebServer::admitRequest( request ) )
+      return;
     //
     // set content type of file
     //
@@ -586,173 +1216,311 @@ namespace measure_h2o
   }
 
   /**
-   * handle non-physical files
+   * deliver a day file, day files only grow while the day
+   * supports If-None-Match/If-Modified-Since (304) and "Range: bytes=N-" (206, only the tail)
    */
-  void APIWebServer::handleNotPhysicFileSources( String &filePath, AsyncWebServerRequest *request )
+  void APIWebServer::deliverDataFile( String &filePath, AsyncWebServerRequest *request )
   {
-    // TODO: implemtieren von virtuellen datenpdaden
-    if ( filePath == "/version.html" )
+    String contentType( "text/plain" );
+    char etag[ 24 ];
+    char lastModified[ 32 ];
+
+    if ( !prefs::AppStati::getIsSpiffsInit() || !SPIFFS.exists( filePath ) )
     {
-      request->send_P( 200, "text/html", version_html, APIWebServer::tProcessor );
+      APIWebServer::onNotFound( request );
       return;
     }
-    else if ( filePath == "/info.html" )
+    if ( !APIWebServer::admitRequest( request ) )
+      return;
+    File fh = SPIFFS.open( filePath, "r" );
+    if ( !fh )
     {
-      request->send_P( 200, "text/html", info_html, APIWebServer::tProcessor );
+      APIWebServer::onNotFound( request );
       return;
     }
-    else if ( filePath == "/intervall.html" )
+    size_t size = fh.size();
+    time_t modified = fh.getLastWrite();
+    snprintf( etag, sizeof( etag ), "\"%x-%lx\"", static_cast< unsigned >( size ), static_cast< unsigned long >( modified ) );
+    APIWebServer::formatHttpDate( lastModified, sizeof( lastModified ), modified );
+    //
+    // client has this version?
+    //
+    bool notModified{ false };
+    if ( request->hasHeader( "If-None-Match" ) )
+      notModified = request->getHeader( "If-None-Match" )->value().indexOf( etag ) >= 0;
+    else if ( request->hasHeader( "If-Modified-Since" ) && modified > 0 )
+      notModified = modified <= APIWebServer::parseHttpDate( request->getHeader( "If-Modified-Since" )->value().c_str() );
+    if ( notModified )
     {
-      request->send_P( 200, "text/html", intervall_html, APIWebServer::tProcessor );
+      fh.close();
+      AsyncWebServerResponse *response = request->beginResponse( 304 );
+      response->addHeader( "ETag", etag );
+      request->send( response );
       return;
     }
-
-    APIWebServer::onNotFound( request );
+    //
+    // range request, only "bytes=N-" and "bytes=N-M"
+    //
+    size_t from{ 0 };
+    size_t to{ size > 0 ? size - 1 : 0 };
+    bool isRange{ false };
+    if ( request->hasHeader( "Range" ) )
+    {
+      unsigned long rFrom{ 0 }, rTo{ 0 };
+      const char *range = request->getHeader( "Range" )->value().c_str();
+      int found = sscanf( range, "bytes=%lu-%lu", &rFrom, &rTo );
+      if ( found >= 1 )
+      {
+        if ( rFrom >= size )
+        {
+          fh.close();
+          char contentRange[ 24 ];
+          snprintf( contentRange, sizeof( contentRange ), "bytes */%u", static_cast< unsigned >( size ) );
+          AsyncWebServerResponse *response = request->beginResponse( 416 );
+          response->addHeader( "Content-Range", contentRange );
+          response->addHeader( "ETag", etag );
+          request->send( response );
+          return;
+        }
+        isRange = true;
+        from = rFrom;
+        if ( found == 2 && rTo >= rFrom && rTo < size )
+          to = rTo;
+      }
+    }
+    APIWebServer::setContentTypeFromFile( contentType, filePath );
+    AsyncWebServerResponse *response{ nullptr };
+    if ( isRange )
+    {
+      size_t len = to - from + 1;
+      fh.seek( from );
+      // the lambda holds the file open until the response is sent
+      response = request->beginResponse( contentType, len,
+                                         [ fh, len ]( uint8_t *buffer, size_t maxLen, size_t index ) mutable -> size_t {
+                                           if ( index >= len )
+                                             return 0;
+                                           return fh.read( buffer, std::min( maxLen, len - index ) );
+                                         } );
+      char contentRange[ 48 ];
+      snprintf( contentRange, sizeof( contentRange ), "bytes %u-%u/%u", static_cast< unsigned >( from ), static_cast< unsigned >( to ),
+                static_cast< unsigned >( size ) );
+      response->setCode( 206 );
+      response->addHeader( "Content-Range", contentRange );
+      elog.log( DEBUG, "%s: file <%s> range <%s>", APIWebServer::tag, filePath.c_str(), contentRange );
+    }
+    else
+    {
+      fh.close();
+      response = request->beginResponse( SPIFFS, filePath, contentType, false );
+    }
+    response->addHeader( "Server", "ESP Environment Server" );
+    response->addHeader( "ETag", etag );
+    response->addHeader( "Last-Modified", lastModified );
+    response->addHeader( "Accept-Ranges", "bytes" );
+    response->addHeader( "Cache-Control", "no-cache" );
+    request->send( response );
   }
 
   /**
-   * if there is an server error
+   * time as http date, e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
    */
-  void APIWebServer::onServerError( AsyncWebServerRequest *request, int errNo, const String &msg )
+  void APIWebServer::formatHttpDate( char *buffer, size_t len, time_t stamp )
   {
-    prefs::AppStati::httpActive = true;
-    String myUrl( request->url() );
-    elog.log( ERROR, "%s: Server ERROR: %03d - %s", APIWebServer::tag, errNo, msg.c_str() );
-    request->send( errNo, "text/plain", msg );
+    struct tm ti;
+    gmtime_r( &stamp, &ti );
+    strftime( buffer, len, "%a, %d %b %Y %H:%M:%S GMT", &ti );
   }
 
   /**
-   * File-Not-Fopuind Errormessage
+   * http date (IMF-fixdate) to UTC secounds, 0 if not parseable
    */
-  void APIWebServer::onNotFound( AsyncWebServerRequest *request )
+  time_t APIWebServer::parseHttpDate( const char *date )
   {
-    prefs::AppStati::httpActive = true;
-    String myUrl( request->url() );
-    elog.log( WARNING, "%s: url not found <%s>", APIWebServer::tag, myUrl.c_str() );
-    request->send( 404, "text/plain", "URL not found: <" + myUrl + ">" );
+    static const char *months{ "JanFebMarAprMayJunJulAugSepOctNovDec" };
+    char mon[ 4 ];
+    int day, year, hour, minute, second;
+
+    if ( sscanf( date, "%*3s, %d %3s %d %d:%d:%d", &day, mon, &year, &hour, &minute, &second ) != 6 )
+      return 0;
+    const char *found = strstr( months, mon );
+    if ( !found || strlen( mon ) != 3 )
+      return 0;
+    int month = static_cast< int >( found - months ) / 3 + 1;
+    //
+    // days since 1970-01-01 (civil calendar), no timezone involved
+    //
+    int y = year - ( month <= 2 ? 1 : 0 );
+    int era = y / 400;
+    int yoe = y - era * 400;
+    int doy = ( 153 * ( month + ( month > 2 ? -3 : 9 ) ) + 2 ) / 5 + day - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long days = static_cast< long >( era ) * 146097L + doe - 719468L;
+    return static_cast< time_t >( days * 86400L + hour * 3600L + minute * 60L + second );
   }
 
   /**
-   * find out what is the content type fron the file extension
+   * deliver a web file from the firmware, the gzip variant if the
+   * client accepts it, 304 if the client has this version cached
    */
-  String APIWebServer::setContentTypeFromFile( String &contentType, const String &filename )
+  void APIWebServer::deliverWwwAsset( const www_asset_t &asset, AsyncWebServerRequest *request )
   {
-    String type = "text";
+    String contentType( "text/plain" );
+    char etag[ 24 ];
 
-    if ( filename.endsWith( ".pdf" ) )
-    {
-      type = "pdf";
-      contentType = "application/pdf";
-      return type;
-    }
-    if ( filename.endsWith( ".html" ) )
-    {
-      type = "html";
-      contentType = "text/html";
-      return type;
-    }
-    if ( filename.endsWith( ".jpeg" ) )
-    {
-      type = "jpeg";
-      contentType = "image/jpeg";
-      return type;
-    }
-    if ( filename.endsWith( ".ico" ) )
-    {
-      type = "icon";
-      contentType = "image/x-icon";
-      return type;
-    }
-    if ( filename.endsWith( ".json" ) )
-    {
-      type = "json";
-      contentType = "application/json";
-      return type;
-    }
-    if ( filename.endsWith( ".jdata" ) )
-    {
-      // my own marker for my "raw" fileformat
-      type = "jdata";
-      contentType = "application/json";
-      return type;
-    }
-    if ( filename.endsWith( "js.gz" ) )
-    {
-      type = "js.gz";
-      contentType = "text/javascript";
-      return type;
-    }
-    if ( filename.endsWith( ".js" ) )
-    {
-      type = "js";
-      contentType = "text/javascript";
-      return type;
-    }
-    if ( filename.endsWith( ".css" ) )
+    bool useGzip = request->hasHeader( "Accept-Encoding" ) && request->getHeader( "Accept-Encoding" )->value().indexOf( "gzip" ) >= 0;
+    snprintf( etag, sizeof( etag ), "\"%s%s\"", asset.etag, useGzip ? "-gz" : "" );
+    //
+    // client has the same version
+    //
+    if ( request->hasHeader( "If-None-Match" ) && request->getHeader( "If-None-Match" )->value().indexOf( etag ) >= 0 )
     {
-      type = "css";
-      contentType = "text/css";
-      return type;
+      elog.log( DEBUG, "%s: file <%s> not modified", APIWebServer::tag, asset.path );
+      AsyncWebServerResponse *response = request->beginResponse( 304 );
+      response->addHeader( "ETag", etag );
+      request->send( response );
+      return;
     }
     //
-    // This is a limited set only
-    // For any other type always set as plain text
+    // send direct from flash, no copy, no filesystem
     //
-    contentType = "text/plain";
-    return type;
+    APIWebServer::setContentTypeFromFile( contentType, String( asset.path ) );
+    AsyncWebServerResponse *response = useGzip ? request->beginResponse_P( 200, contentType, asset.gzData, asset.gzSize )
+                                               : request->beginResponse_P( 200, contentType, asset.data, asset.size );
+    response->addHeader( "Server", "ESP Environment Server" );
+    response->addHeader( "ETag", etag );
+    response->addHeader( "Cache-Control", "no-cache" );
+    response->addHeader( "Vary", "Accept-Encoding" );
+    if ( useGzip )
+      response->addHeader( "Content-Encoding", "gzip" );
+    request->send( response );
   }
 
-  String APIWebServer::tProcessor( const String &var )
+  /**
+   * deliver a html template from the firmware
+   * the segments are copied direct into the send buffer
+   */
+  void APIWebServer::deliverTemplate( const www_template_t &tmpl, AsyncWebServerRequest *request )
   {
-    if ( var == "APP_VERSION" )
+    size_t total{ 0 };
+    for ( size_t i = 0; i < tmpl.count; ++i )
     {
-      String versionStr( prefs::VERSION );
-      return versionStr;
+      const www_segment_t &seg = tmpl.segments[ i ];
+      total += seg.text ? seg.len : strlen( APIWebServer::tmplValues[ static_cast< size_t >( seg.var ) ] );
     }
-    else if ( var == "IDF_VERSION" )
-    {
-      String versionStr( IDF_VER );
-      return versionStr;
-    }
-    else if ( var == "ESP_MODEL" )
+    const www_template_t *tmplPtr = &tmpl;
+    AsyncWebServerResponse *response =
+        request->beginResponse( "text/html", total, [ tmplPtr ]( uint8_t *buffer, size_t maxLen, size_t index ) -> size_t {
+          return APIWebServer::fillTemplate( *tmplPtr, buffer, maxLen, index );
+        } );
+    response->addHeader( "Server", "ESP Environment Server" );
+    request->send( response );
+  }
+
+  /**
+   * copy the part from <index> of the rendered template into buffer
+   */
+  size_t APIWebServer::fillTemplate( const www_template_t &tmpl, uint8_t *buffer, size_t maxLen, size_t index )
+  {
+    size_t written{ 0 };
+    size_t offset{ 0 };
+
+    for ( size_t i = 0; i < tmpl.count && written < maxLen; ++i )
     {
-      esp_chip_info_t chip_info;
-      esp_chip_info( &chip_info );
-      String model( "-" );
-      switch ( chip_info.model )
+      const www_segment_t &seg = tmpl.segments[ i ];
+      const char *text = seg.text ? seg.text : APIWebServer::tmplValues[ static_cast< size_t >( seg.var ) ];
+      size_t len = seg.text ? seg.len : strlen( text );
+      size_t pos = index + written;
+      if ( pos < offset + len )
       {
-        default:
-        case CHIP_ESP32:
-          model = "ESP32";
-          break;
-        case CHIP_ESP32S2:
-          model = "ESP32-S2";
-          break;
-        case CHIP_ESP32S3:
-          model = "ESP32-S3";
-          break;
-        case CHIP_ESP32C3:
-          model = "ESP32-C3";
-          break;
-        case CHIP_ESP32H2:
-          model = "ESP32-H2";
-          break;
+        size_t count = std::min( offset + len - pos, maxLen - written );
+        memcpy( buffer + written, text + ( pos - offset ), count );
+        written += count;
       }
-      return model;
+      offset += len;
     }
-    else if ( var == "ESP_CORES" )
+    return written;
+  }
+
+  /**
+   * if there is an server error
+   */
+  void APIWebServer::onServerError( AsyncWebServerRequest *request, int errNo, const char *fmt, ... )
+  {
+    prefs::AppStati::httpActive = true;
+    RequestArena *arena = RequestArena::get( request );
+    if ( !arena )
     {
-      esp_chip_info_t chip_info;
-      esp_chip_info( &chip_info );
-      String coresCount( chip_info.cores );
-      return coresCount;
+      APIWebServer::sendBusy( request );
+      return;
     }
-    else if ( var == "MEASURE_INTERVAL" )
+    va_list args;
+    va_start( args, fmt );
+    arena->vappend( fmt, args );
+    va_end( args );
+    elog.log( ERROR, "%s: Server ERROR: %03d - %s", APIWebServer::tag, errNo, arena->c_str() );
+    arena->send( errNo, "text/plain" );
+  }
+
+  /**
+   * File-Not-Fopuind Errormessage
+   */
+  void APIWebServer::onNotFound( AsyncWebServerRequest *request )
+  {
+    prefs::AppStati::httpActive = true;
+    elog.log( WARNING, "%s: url not found <%s>", APIWebServer::tag, request->url().c_str() );
+    APIWebServer::sendText( request, 404, "URL not found: <%s>", request->url().c_str() );
+  }
+
+  /**
+   * find out what is the content type fron the file extension
+   */
+  String APIWebServer::setContentTypeFromFile( String &contentType, const String &filename )
+  {
+    for ( const content_type_t &entry : APIWebServer::contentTypes )
     {
-      String interval( prefs::MEASURE_DIFF_TIME_S );
-      return interval;
+      if ( filename.endsWith( entry.suffix ) )
+      {
+        contentType = entry.type;
+        return String( entry.marker );
+      }
     }
+    contentType = "text/plain";
+    return String( "text" );
+  }
 
-    return String();
+  /**
+   * make the values for the template placeholders
+   */
+  void APIWebServer::initTemplateValues()
+  {
+    esp_chip_info_t chip_info;
+    esp_chip_info( &chip_info );
+    const char *model{ "ESP32" };
+    switch ( chip_info.model )
+    {
+      default:
+      case CHIP_ESP32:
+        model = "ESP32";
+        break;
+      case CHIP_ESP32S2:
+        model = "ESP32-S2";
+        break;
+      case CHIP_ESP32S3:
+        model = "ESP32-S3";
+        break;
+      case CHIP_ESP32C3:
+        model = "ESP32-C3";
+        break;
+      case CHIP_ESP32H2:
+        model = "ESP32-H2";
+        break;
+    }
+    auto value = []( TmplVar var ) -> char * { return APIWebServer::tmplValues[ static_cast< size_t >( var ) ]; };
+    snprintf( value( TmplVar::APP_VERSION ), prefs::WWW_TMPL_VALUE_LEN, "%s", prefs::VERSION );
+    snprintf( value( TmplVar::IDF_VERSION ), prefs::WWW_TMPL_VALUE_LEN, "%s", IDF_VER );
+    snprintf( value( TmplVar::ESP_MODEL ), prefs::WWW_TMPL_VALUE_LEN, "%s", model );
+    snprintf( value( TmplVar::ESP_CORES ), prefs::WWW_TMPL_VALUE_LEN, "%d", static_cast< int >( chip_info.cores ) );
+    snprintf( value( TmplVar::MEASURE_INTERVAL ), prefs::WWW_TMPL_VALUE_LEN, "%u",
+              static_cast< unsigned >( prefs::MEASURE_DIFF_TIME_S ) );
   }
 }  // namespace measure_h2o
@@ -1,7 +1,7 @@
 #include <Esp.h>
-#include <TimeLib.h>
 #include "wifiConfig.hpp"
 #include "appStati.hpp"
+#include "timeKeeper.hpp"
 
 namespace measure_h2o
 {
@@ -121,7 +121,7 @@ namespace measure_h2o
   /**
    * if an event for systemtime, tell me this
    */
-  void WifiConfig::timeSyncNotificationCallback( struct timeval * )
+  void WifiConfig::timeSyncNotificationCallback( struct timeval *tv )
   {
     sntp_sync_status_t state = sntp_get_sync_status();
     switch ( state )
@@ -133,16 +133,14 @@ namespace measure_h2o
         {
           prefs::AppStati::setWlanState( WlanState::TIMESYNCED );
         }
-        struct tm ti;
-        if ( !getLocalTime( &ti ) )
+        //
+        // calibrate the app clock, the logger gets the time from there
+        //
+        TimeKeeper::onSync( tv );
         {
-          elog.log( WARNING, "%s: failed to obtain systemtime!", WifiConfig::tag );
-        }
-        else
-        {
-          elog.log( DEBUG, "%s: gotten system time!", WifiConfig::tag );
+          struct tm ti;
+          TimeKeeper::toLocal( TimeKeeper::now(), ti );
           Elog::provideTime( ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday, ti.tm_hour, ti.tm_min, ti.tm_sec );
-          setTime( ti.tm_hour, ti.tm_min, ti.tm_sec, ti.tm_mday, ti.tm_mon + 1, ti.tm_year + 1900 );
         }
         break;
       default:
@@ -0,0 +1,183 @@
+//
+// host test of the anomaly detector (src/anomalyDetector.cpp)
+// pio test -e native -f test_anomalydetector
+//
+#include <unity.h>
+#include "anomalyDetector.hpp"
+
+using measure_h2o::anomaly_params_t;
+using measure_h2o::AnomalyDetector;
+using measure_h2o::AnomalyType;
+
+// as in appPrefs: edge 150 mbar, draw 50 mbar/min, gap 600 s, night 1800 s and 100 mbar/h,
+// 12 starts/h, CUSUM window 10, k 3 mbar/min, h 40 mbar/min, baseline 1/16
+static const anomaly_params_t params{ 150, 50, 600, 1800, 100, 12, 10, 48, 640, 4 };
+
+// a clock hour, the measures every minute
+static const uint32_t HOUR_START = 400000U * 3600U;
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static void test_pump_cycling( void )
+{
+  AnomalyDetector detector( params );
+  int32_t value;
+  AnomalyType found{ AnomalyType::NONE };
+  int32_t starts{ 0 };
+  uint32_t sec = HOUR_START;
+  detector.update( sec, 3000, false, value );
+  // pump starts every two minutes, the 13th in the hour is too many
+  for ( uint32_t start = 1; start <= 13; ++start )
+  {
+    sec += 60;
+    found = detector.update( sec, 3300, false, value );
+    starts = value;
+    if ( start < 13 )
+      TEST_ASSERT_TRUE( found == AnomalyType::NONE );
+    sec += 60;
+    TEST_ASSERT_TRUE( detector.update( sec, 3000, false, value ) == AnomalyType::NONE );
+  }
+  TEST_ASSERT_TRUE( found == AnomalyType::PUMP_CYCLING );
+  TEST_ASSERT_EQUAL_INT32( 13, starts );
+  TEST_ASSERT_EQUAL_UINT32( 13, detector.getStartsThisHour() );
+  TEST_ASSERT_EQUAL_UINT32( 13, detector.getPumpStarts() );
+  // next clock hour: the count moves to the hour before
+  detector.update( HOUR_START + 3600, 3000, false, value );
+  TEST_ASSERT_EQUAL_UINT32( 0, detector.getStartsThisHour() );
+  TEST_ASSERT_EQUAL_UINT32( 13, detector.getStartsLastHour() );
+}
+
+//
+// quiet night falling _mbarMin per minute for _minutes, then the first sample of the day
+//
+static AnomalyType night( AnomalyDetector &_detector, int32_t _mbarMin, uint32_t _minutes, int32_t &_value )
+{
+  AnomalyType found{ AnomalyType::NONE };
+  for ( uint32_t minute = 0; minute <= _minutes; ++minute )
+  {
+    found = _detector.update( HOUR_START + minute * 60, 3000 - _mbarMin * static_cast< int32_t >( minute ), true, _value );
+    TEST_ASSERT_TRUE( found == AnomalyType::NONE );
+  }
+  uint32_t next = _minutes + 1;
+  return _detector.update( HOUR_START + next * 60, 3000 - _mbarMin * static_cast< int32_t >( next ), false, _value );
+}
+
+static void test_night_decay( void )
+{
+  AnomalyDetector detector( params );
+  int32_t value;
+  // 5 mbar/min == 300 mbar/h, a leak
+  TEST_ASSERT_TRUE( night( detector, 5, 40, value ) == AnomalyType::NIGHT_DECAY );
+  TEST_ASSERT_EQUAL_INT32( -300, value );
+  TEST_ASSERT_EQUAL_INT32( -300, detector.getNightSlope() );
+}
+
+static void test_night_slow_decay_is_normal( void )
+{
+  AnomalyDetector detector( params );
+  int32_t value;
+  // 1 mbar/min == 60 mbar/h, below the limit
+  TEST_ASSERT_TRUE( night( detector, 1, 40, value ) == AnomalyType::NONE );
+  TEST_ASSERT_EQUAL_INT32( -60, detector.getNightSlope() );
+}
+
+static void test_night_segment_too_short( void )
+{
+  AnomalyDetector detector( params );
+  int32_t value;
+  // 20 minutes are less than 1800 s, no slope
+  TEST_ASSERT_TRUE( night( detector, 5, 20, value ) == AnomalyType::NONE );
+  TEST_ASSERT_EQUAL_INT32( 0, detector.getNightSlope() );
+}
+
+static void test_decay_shift( void )
+{
+  AnomalyDetector detector( params );
+  int32_t value;
+  uint32_t sec = HOUR_START;
+  int32_t mbar = 4000;
+  detector.update( sec, mbar, false, value );
+  // normal decay 1 mbar/min, the baseline
+  for ( size_t sample = 0; sample < 100; ++sample )
+  {
+    sec += 60;
+    mbar -= 1;
+    TEST_ASSERT_TRUE( detector.update( sec, mbar, false, value ) == AnomalyType::NONE );
+  }
+  TEST_ASSERT_EQUAL_INT32( 16, detector.getBaselineQ4() );
+  TEST_ASSERT_EQUAL_INT32( 0, detector.getCusumQ4() );
+  // 10 mbar/min (still no draw): 96 per window into the sum, over 640 after 7 windows
+  size_t events{ 0 };
+  size_t eventSample{ 0 };
+  for ( size_t sample = 0; sample < 200; ++sample )
+  {
+    sec += 60;
+    mbar -= 10;
+    if ( detector.update( sec, mbar, false, value ) == AnomalyType::DECAY_SHIFT )
+    {
+      ++events;
+      eventSample = sample;
+      TEST_ASSERT_EQUAL_INT32( 9, value );
+    }
+  }
+  // one event per change, the new rate is the baseline
+  TEST_ASSERT_EQUAL_UINT32( 1, events );
+  TEST_ASSERT_EQUAL_UINT32( 69, eventSample );
+  TEST_ASSERT_EQUAL_INT32( 160, detector.getBaselineQ4() );
+}
+
+static void test_draw_is_not_quiet( void )
+{
+  AnomalyDetector detector( params );
+  int32_t value;
+  uint32_t sec = HOUR_START;
+  int32_t mbar = 4000;
+  detector.update( sec, mbar, false, value );
+  for ( size_t sample = 0; sample < 100; ++sample )
+  {
+    sec += 60;
+    mbar -= 1;
+    detector.update( sec, mbar, false, value );
+  }
+  // 100 mbar/min is water drawn, no decay window
+  for ( size_t sample = 0; sample < 200; ++sample )
+  {
+    sec += 60;
+    mbar = sample % 2 ? mbar + 100 : mbar - 100;
+    TEST_ASSERT_TRUE( detector.update( sec, mbar, false, value ) == AnomalyType::NONE );
+  }
+  TEST_ASSERT_EQUAL_INT32( 16, detector.getBaselineQ4() );
+  TEST_ASSERT_EQUAL_INT32( 0, detector.getCusumQ4() );
+}
+
+static void test_names( void )
+{
+  TEST_ASSERT_EQUAL_STRING( "none", AnomalyDetector::getName( AnomalyType::NONE ) );
+  TEST_ASSERT_EQUAL_STRING( "night-decay", AnomalyDetector::getName( AnomalyType::NIGHT_DECAY ) );
+  TEST_ASSERT_EQUAL_STRING( "pump-cycling", AnomalyDetector::getName( AnomalyType::PUMP_CYCLING ) );
+  TEST_ASSERT_EQUAL_STRING( "decay-shift", AnomalyDetector::getName( AnomalyType::DECAY_SHIFT ) );
+}
+
+int runUnityTests( void )
+{
+  UNITY_BEGIN();
+  RUN_TEST( test_pump_cycling );
+  RUN_TEST( test_night_decay );
+  RUN_TEST( test_night_slow_decay_is_normal );
+  RUN_TEST( test_night_segment_too_short );
+  RUN_TEST( test_decay_shift );
+  RUN_TEST( test_draw_is_not_quiet );
+  RUN_TEST( test_names );
+  return UNITY_END();
+}
+
+int main( void )
+{
+  return runUnityTests();
+}
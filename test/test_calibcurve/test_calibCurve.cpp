@@ -0,0 +1,119 @@
+//
+// host test of the calibration curve (src/calibCurve.cpp)
+// pio test -e native -f test_calibcurve
+//
+#include <unity.h>
+#include "calibCurve.hpp"
+
+using measure_h2o::calib_point_t;
+using measure_h2o::CalibCurve;
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static void test_no_curve_below_two_points( void )
+{
+  CalibCurve curve;
+  TEST_ASSERT_FALSE( curve.isCurve() );
+  TEST_ASSERT_EQUAL_INT32( -1, curve.getZeroMv() );
+  const calib_point_t one[]{ { 500, 0 } };
+  curve.build( one, 1 );
+  TEST_ASSERT_FALSE( curve.isCurve() );
+  TEST_ASSERT_EQUAL_INT32( -1, curve.getZeroMv() );
+}
+
+static void test_lookup_between_points( void )
+{
+  const calib_point_t points[]{ { 1000, 0 }, { 2000, 1000 }, { 3000, 3000 } };
+  CalibCurve curve;
+  curve.build( points, 3 );
+  TEST_ASSERT_TRUE( curve.isCurve() );
+  TEST_ASSERT_EQUAL_INT32( 0, curve.toMbar( 1000 ) );
+  TEST_ASSERT_EQUAL_INT32( 500, curve.toMbar( 1500 ) );
+  TEST_ASSERT_EQUAL_INT32( 1000, curve.toMbar( 2000 ) );
+  TEST_ASSERT_EQUAL_INT32( 2000, curve.toMbar( 2500 ) );
+  TEST_ASSERT_EQUAL_INT32( 3000, curve.toMbar( 3000 ) );
+  // rounded, 2 mbar per mV in the second segment
+  TEST_ASSERT_EQUAL_INT32( 1002, curve.toMbar( 2001 ) );
+}
+
+static void test_extrapolation( void )
+{
+  const calib_point_t points[]{ { 1000, 0 }, { 2000, 1000 }, { 3000, 3000 } };
+  CalibCurve curve;
+  curve.build( points, 3 );
+  // below with the first segment, above with the last
+  TEST_ASSERT_EQUAL_INT32( -500, curve.toMbar( 500 ) );
+  TEST_ASSERT_EQUAL_INT32( 4000, curve.toMbar( 3500 ) );
+}
+
+static void test_all_segments_found( void )
+{
+  // full curve, slope of segment i is i + 1 mbar per mV
+  calib_point_t points[ CalibCurve::MAX_POINTS ];
+  int32_t mbar{ 0 };
+  for ( size_t idx = 0; idx < CalibCurve::MAX_POINTS; ++idx )
+  {
+    points[ idx ].miliVolts = static_cast< uint16_t >( 500 + idx * 100 );
+    points[ idx ].mbar = static_cast< int16_t >( mbar );
+    mbar += static_cast< int32_t >( idx + 1 ) * 100;
+  }
+  CalibCurve curve;
+  curve.build( points, CalibCurve::MAX_POINTS );
+  for ( size_t idx = 0; idx + 1 < CalibCurve::MAX_POINTS; ++idx )
+  {
+    int32_t mid = points[ idx ].miliVolts + 50;
+    TEST_ASSERT_EQUAL_INT32( points[ idx ].mbar + static_cast< int32_t >( idx + 1 ) * 50, curve.toMbar( mid ) );
+    TEST_ASSERT_EQUAL_INT32( points[ idx + 1 ].mbar, curve.toMbar( points[ idx + 1 ].miliVolts ) );
+  }
+  // past the last point the last segment goes on (slope 7)
+  TEST_ASSERT_EQUAL_INT32( points[ 7 ].mbar + 700, curve.toMbar( points[ 7 ].miliVolts + 100 ) );
+}
+
+static void test_zero_point( void )
+{
+  CalibCurve curve;
+  const calib_point_t fromZero[]{ { 480, 0 }, { 2480, 4000 } };
+  curve.build( fromZero, 2 );
+  TEST_ASSERT_EQUAL_INT32( 480, curve.getZeroMv() );
+  // curve starts above 0 mbar, zero point extrapolated
+  const calib_point_t above[]{ { 1000, 500 }, { 2000, 1500 } };
+  curve.build( above, 2 );
+  TEST_ASSERT_EQUAL_INT32( 500, curve.getZeroMv() );
+  // zero point below 0 mV is not known
+  const calib_point_t negative[]{ { 100, 2000 }, { 200, 3000 } };
+  curve.build( negative, 2 );
+  TEST_ASSERT_EQUAL_INT32( -1, curve.getZeroMv() );
+}
+
+static void test_rebuild_removes_curve( void )
+{
+  const calib_point_t points[]{ { 1000, 0 }, { 2000, 1000 } };
+  CalibCurve curve;
+  curve.build( points, 2 );
+  TEST_ASSERT_TRUE( curve.isCurve() );
+  curve.build( nullptr, 0 );
+  TEST_ASSERT_FALSE( curve.isCurve() );
+}
+
+int runUnityTests( void )
+{
+  UNITY_BEGIN();
+  RUN_TEST( test_no_curve_below_two_points );
+  RUN_TEST( test_lookup_between_points );
+  RUN_TEST( test_extrapolation );
+  RUN_TEST( test_all_segments_found );
+  RUN_TEST( test_zero_point );
+  RUN_TEST( test_rebuild_removes_curve );
+  return UNITY_END();
+}
+
+int main( void )
+{
+  return runUnityTests();
+}
@@ -0,0 +1,126 @@
+//
+// host test of the pump cycle detector (src/pumpCycles.cpp)
+// pio test -e native -f test_pumpcycles
+//
+#include <unity.h>
+#include "pumpCycles.hpp"
+
+using measure_h2o::pump_cycle_params_t;
+using measure_h2o::pump_cycle_t;
+using measure_h2o::PumpCycleDetector;
+using measure_h2o::PUMP_CYCLE_SHORT;
+using measure_h2o::PUMP_OFF_UNKNOWN;
+
+// as in appPrefs: start 150 mbar, stop 30 mbar, gap 600 s, short on 60 s, short distance 300 s
+static const pump_cycle_params_t params{ 150, 30, 600, 60, 300 };
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static void test_flat_pressure_no_cycle( void )
+{
+  PumpCycleDetector detector( params );
+  pump_cycle_t cycle;
+  for ( uint32_t sec = 0; sec < 3600; sec += 30 )
+    TEST_ASSERT_FALSE( detector.update( sec, 3000 - static_cast< int32_t >( sec / 60 ), cycle ) );
+  TEST_ASSERT_FALSE( detector.isOn() );
+}
+
+static void test_cycle_edges( void )
+{
+  PumpCycleDetector detector( params );
+  pump_cycle_t cycle;
+  TEST_ASSERT_FALSE( detector.update( 1000, 3000, cycle ) );
+  // rise of 200 mbar: on, the start is the measure before
+  TEST_ASSERT_FALSE( detector.update( 1030, 3200, cycle ) );
+  TEST_ASSERT_TRUE( detector.isOn() );
+  TEST_ASSERT_FALSE( detector.update( 1060, 3400, cycle ) );
+  TEST_ASSERT_FALSE( detector.update( 1090, 3500, cycle ) );
+  // rise less than 30 mbar: peak was the measure before
+  TEST_ASSERT_TRUE( detector.update( 1120, 3510, cycle ) );
+  TEST_ASSERT_FALSE( detector.isOn() );
+  TEST_ASSERT_EQUAL_UINT32( 1000, cycle.start );
+  TEST_ASSERT_EQUAL_UINT16( 90, cycle.onSec );
+  TEST_ASSERT_EQUAL_UINT16( PUMP_OFF_UNKNOWN, cycle.offSec );
+  TEST_ASSERT_EQUAL_INT16( 3000, cycle.startMbar );
+  TEST_ASSERT_EQUAL_INT16( 3500, cycle.peakMbar );
+  TEST_ASSERT_EQUAL_INT16( 333, cycle.rateMbarMin );
+  TEST_ASSERT_EQUAL_UINT8( 0, cycle.flags );
+}
+
+static void test_off_time_and_short_cycles( void )
+{
+  PumpCycleDetector detector( params );
+  pump_cycle_t cycle;
+  detector.update( 1000, 3000, cycle );
+  detector.update( 1030, 3200, cycle );
+  detector.update( 1060, 3400, cycle );
+  TEST_ASSERT_TRUE( detector.update( 1090, 3405, cycle ) );
+  // second cycle 540 s after the peak, on for 60 s: normal
+  detector.update( 1300, 3100, cycle );
+  detector.update( 1600, 3000, cycle );
+  detector.update( 1630, 3200, cycle );
+  detector.update( 1660, 3400, cycle );
+  TEST_ASSERT_TRUE( detector.update( 1690, 3410, cycle ) );
+  TEST_ASSERT_EQUAL_UINT16( 540, cycle.offSec );
+  TEST_ASSERT_EQUAL_UINT16( 60, cycle.onSec );
+  TEST_ASSERT_EQUAL_UINT8( 0, cycle.flags );
+  // third cycle 60 s after the peak, on for 30 s: short
+  detector.update( 1720, 3250, cycle );
+  detector.update( 1750, 3450, cycle );
+  TEST_ASSERT_TRUE( detector.update( 1780, 3460, cycle ) );
+  TEST_ASSERT_EQUAL_UINT16( 60, cycle.offSec );
+  TEST_ASSERT_EQUAL_UINT16( 30, cycle.onSec );
+  TEST_ASSERT_EQUAL_UINT8( PUMP_CYCLE_SHORT, cycle.flags );
+}
+
+static void test_short_on_time_only( void )
+{
+  PumpCycleDetector detector( params );
+  pump_cycle_t cycle;
+  detector.update( 1000, 3000, cycle );
+  detector.update( 1030, 3300, cycle );
+  TEST_ASSERT_TRUE( detector.update( 1060, 3300, cycle ) );
+  TEST_ASSERT_EQUAL_UINT16( 30, cycle.onSec );
+  TEST_ASSERT_EQUAL_UINT16( PUMP_OFF_UNKNOWN, cycle.offSec );
+  TEST_ASSERT_EQUAL_UINT8( PUMP_CYCLE_SHORT, cycle.flags );
+}
+
+static void test_gap_loses_cycle( void )
+{
+  PumpCycleDetector detector( params );
+  pump_cycle_t cycle;
+  detector.update( 1000, 3000, cycle );
+  detector.update( 1030, 3200, cycle );
+  TEST_ASSERT_TRUE( detector.isOn() );
+  // no measure for more than 600 s
+  TEST_ASSERT_FALSE( detector.update( 1700, 3500, cycle ) );
+  TEST_ASSERT_FALSE( detector.isOn() );
+  TEST_ASSERT_FALSE( detector.update( 1730, 3505, cycle ) );
+  // time back (sync) is a gap too
+  detector.update( 1760, 3700, cycle );
+  TEST_ASSERT_TRUE( detector.isOn() );
+  TEST_ASSERT_FALSE( detector.update( 1500, 3700, cycle ) );
+  TEST_ASSERT_FALSE( detector.isOn() );
+}
+
+int runUnityTests( void )
+{
+  UNITY_BEGIN();
+  RUN_TEST( test_flat_pressure_no_cycle );
+  RUN_TEST( test_cycle_edges );
+  RUN_TEST( test_off_time_and_short_cycles );
+  RUN_TEST( test_short_on_time_only );
+  RUN_TEST( test_gap_loses_cycle );
+  return UNITY_END();
+}
+
+int main( void )
+{
+  return runUnityTests();
+}
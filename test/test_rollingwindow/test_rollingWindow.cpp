@@ -0,0 +1,147 @@
+//
+// host test of the sliding window (src/rollingWindow.cpp)
+// pio test -e native -f test_rollingwindow
+//
+#include <unity.h>
+#include "rollingWindow.hpp"
+
+using measure_h2o::rolling_stats_t;
+using measure_h2o::RollingWindow;
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static void test_empty_window( void )
+{
+  RollingWindow window( 120 );
+  rolling_stats_t stats;
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 0, stats.count );
+  TEST_ASSERT_EQUAL_INT32( 0, stats.meanCenti );
+  TEST_ASSERT_EQUAL_UINT32( 120, window.getSpan() );
+}
+
+static void test_mean_and_stddev( void )
+{
+  RollingWindow window( 120 );
+  rolling_stats_t stats;
+  // two in the open bucket, two in closed ones
+  window.add( 1000, 10 );
+  window.add( 1015, 20 );
+  window.add( 1030, 30 );
+  window.add( 1031, 40 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 4, stats.count );
+  TEST_ASSERT_EQUAL_INT32( 10, stats.min );
+  TEST_ASSERT_EQUAL_INT32( 40, stats.max );
+  TEST_ASSERT_EQUAL_INT32( 2500, stats.meanCenti );
+  // population standard deviation sqrt( 125 )
+  TEST_ASSERT_EQUAL_UINT32( 1118, stats.stddevCenti );
+}
+
+static void test_negative_mean_rounded( void )
+{
+  RollingWindow window( 120 );
+  rolling_stats_t stats;
+  window.add( 0, -1 );
+  window.add( 1, -2 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_INT32( -150, stats.meanCenti );
+  TEST_ASSERT_EQUAL_INT32( -2, stats.min );
+  TEST_ASSERT_EQUAL_INT32( -1, stats.max );
+}
+
+static void test_expiry_of_buckets( void )
+{
+  // 12 buckets of 10 s
+  RollingWindow window( 120 );
+  rolling_stats_t stats;
+  window.add( 0, 1 );
+  window.add( 10, 9 );
+  window.add( 20, 3 );
+  window.advance( 119 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 3, stats.count );
+  // bucket 0 (min) leaves the window
+  window.advance( 125 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 2, stats.count );
+  TEST_ASSERT_EQUAL_INT32( 3, stats.min );
+  TEST_ASSERT_EQUAL_INT32( 9, stats.max );
+  TEST_ASSERT_EQUAL_INT32( 600, stats.meanCenti );
+  // bucket 1 (max) leaves the window
+  window.advance( 135 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 1, stats.count );
+  TEST_ASSERT_EQUAL_INT32( 3, stats.min );
+  TEST_ASSERT_EQUAL_INT32( 3, stats.max );
+  TEST_ASSERT_EQUAL_UINT32( 0, stats.stddevCenti );
+  window.advance( 145 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 0, stats.count );
+}
+
+static void test_min_max_over_many_buckets( void )
+{
+  RollingWindow window( 120 );
+  rolling_stats_t stats;
+  // falling then rising values, one per bucket, for three windows
+  for ( uint32_t sec = 0; sec < 360; sec += 10 )
+  {
+    int32_t value = static_cast< int32_t >( ( sec / 10 ) % 7 ) - 3;
+    window.add( sec, value * value );
+    window.get( stats );
+    // reference: the last 12 values
+    int32_t minVal = value * value;
+    int32_t maxVal = value * value;
+    for ( uint32_t back = sec >= 110 ? sec - 110 : 0; back < sec; back += 10 )
+    {
+      int32_t old = static_cast< int32_t >( ( back / 10 ) % 7 ) - 3;
+      minVal = old * old < minVal ? old * old : minVal;
+      maxVal = old * old > maxVal ? old * old : maxVal;
+    }
+    TEST_ASSERT_EQUAL_INT32( minVal, stats.min );
+    TEST_ASSERT_EQUAL_INT32( maxVal, stats.max );
+    TEST_ASSERT_EQUAL_UINT32( sec / 10 + 1 < 12 ? sec / 10 + 1 : 12, stats.count );
+  }
+}
+
+static void test_gap_and_clock_back_restart( void )
+{
+  RollingWindow window( 120 );
+  rolling_stats_t stats;
+  window.add( 1000, 5 );
+  window.add( 1010, 7 );
+  // longer than the window: start empty
+  window.add( 5000, 100 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 1, stats.count );
+  TEST_ASSERT_EQUAL_INT32( 100, stats.min );
+  // clock back (time sync): start empty
+  window.add( 4000, 50 );
+  window.get( stats );
+  TEST_ASSERT_EQUAL_UINT32( 1, stats.count );
+  TEST_ASSERT_EQUAL_INT32( 50, stats.max );
+}
+
+int runUnityTests( void )
+{
+  UNITY_BEGIN();
+  RUN_TEST( test_empty_window );
+  RUN_TEST( test_mean_and_stddev );
+  RUN_TEST( test_negative_mean_rounded );
+  RUN_TEST( test_expiry_of_buckets );
+  RUN_TEST( test_min_max_over_many_buckets );
+  RUN_TEST( test_gap_and_clock_back_restart );
+  return UNITY_END();
+}
+
+int main( void )
+{
+  return runUnityTests();
+}
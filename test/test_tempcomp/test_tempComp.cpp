@@ -0,0 +1,126 @@
+//
+// host test of the temperature compensation (src/tempComp.cpp)
+// pio test -e native -f test_tempcomp
+//
+#include <unity.h>
+#include "tempComp.hpp"
+
+using measure_h2o::temp_comp_params_t;
+using measure_h2o::TempComp;
+
+// as in appPrefs: 25.00 °C, 10 mV stable, 0.10 °C step, max 2 mV per °C
+static const temp_comp_params_t params{ 2500, 10, 10, 50000LL, 5000000LL, 1311 };
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+//
+// temperature of the measure, swings by 1 °C (25, 26, 27, 26 °C)
+//
+static int16_t swing( size_t _idx )
+{
+  static const int16_t steps[]{ 2500, 2600, 2700, 2600 };
+  return steps[ _idx % 4 ];
+}
+
+static void test_learn_needs_variation( void )
+{
+  TempComp comp( params );
+  // five pairs of 1 °C make sum dT² = 50000, the first measure has no pair
+  for ( size_t idx = 0; idx < 5; ++idx )
+    TEST_ASSERT_FALSE( comp.learn( swing( idx ), 1000 + ( swing( idx ) - 2500 ) / 100 ) );
+  TEST_ASSERT_EQUAL_INT32( 0, comp.getCoefficient() );
+  TEST_ASSERT_TRUE( comp.learn( swing( 5 ), 1000 + ( swing( 5 ) - 2500 ) / 100 ) );
+  TEST_ASSERT_EQUAL_UINT32( 5, comp.getPairs() );
+  // 1 mV per °C == 0.01 mV per 0.01 °C, Q16
+  TEST_ASSERT_EQUAL_INT32( 655, comp.getCoefficient() );
+}
+
+static void test_learn_negative_drift( void )
+{
+  TempComp comp( params );
+  for ( size_t idx = 0; idx < 12; ++idx )
+    comp.learn( swing( idx ), 1000 - ( swing( idx ) - 2500 ) / 100 );
+  TEST_ASSERT_EQUAL_INT32( -655, comp.getCoefficient() );
+}
+
+static void test_learn_clamps_coefficient( void )
+{
+  TempComp comp( params );
+  // 5 mV per °C, more than the limit
+  for ( size_t idx = 0; idx < 12; ++idx )
+    comp.learn( swing( idx ), 1000 + ( swing( idx ) - 2500 ) / 20 );
+  TEST_ASSERT_EQUAL_INT32( 1311, comp.getCoefficient() );
+  comp.setCoefficient( -5000 );
+  TEST_ASSERT_EQUAL_INT32( -1311, comp.getCoefficient() );
+}
+
+static void test_learn_skips_unusable_pairs( void )
+{
+  TempComp comp( params );
+  comp.learn( 2500, 1000 );
+  // pressure changed: tension not stable
+  comp.learn( 2600, 1050 );
+  TEST_ASSERT_EQUAL_UINT32( 0, comp.getPairs() );
+  // temperature step too small
+  comp.learn( 2605, 1051 );
+  TEST_ASSERT_EQUAL_UINT32( 0, comp.getPairs() );
+  // no temperature, no pair with the measure before and after
+  comp.learn( TempComp::TEMP_UNKNOWN, 1051 );
+  comp.learn( 2705, 1052 );
+  TEST_ASSERT_EQUAL_UINT32( 0, comp.getPairs() );
+  comp.learn( 2805, 1053 );
+  TEST_ASSERT_EQUAL_UINT32( 1, comp.getPairs() );
+}
+
+static void test_learn_forgets_old_pairs( void )
+{
+  temp_comp_params_t small = params;
+  small.minSumXX = 10000;
+  small.maxSumXX = 25000;
+  TempComp comp( small );
+  for ( size_t idx = 0; idx < 3; ++idx )
+    comp.learn( swing( idx ), 1000 + ( swing( idx ) - 2500 ) / 100 );
+  TEST_ASSERT_EQUAL_UINT32( 2, comp.getPairs() );
+  // third pair: sum dT² 30000 > 25000, halved
+  comp.learn( swing( 3 ), 1000 + ( swing( 3 ) - 2500 ) / 100 );
+  TEST_ASSERT_EQUAL_UINT32( 1, comp.getPairs() );
+  TEST_ASSERT_EQUAL_INT32( 655, comp.getCoefficient() );
+}
+
+static void test_compensate_to_reference( void )
+{
+  TempComp comp( params );
+  // no coefficient: unchanged
+  TEST_ASSERT_EQUAL_UINT32( 1010, comp.compensate( 1010, 3500 ) );
+  comp.setCoefficient( 655 );
+  // 10 °C above and below the reference, 1 mV per °C
+  TEST_ASSERT_EQUAL_UINT32( 1000, comp.compensate( 1010, 3500 ) );
+  TEST_ASSERT_EQUAL_UINT32( 1000, comp.compensate( 990, 1500 ) );
+  TEST_ASSERT_EQUAL_UINT32( 1234, comp.compensate( 1234, 2500 ) );
+  TEST_ASSERT_EQUAL_UINT32( 1234, comp.compensate( 1234, TempComp::TEMP_UNKNOWN ) );
+  // never below 0 mV
+  TEST_ASSERT_EQUAL_UINT32( 0, comp.compensate( 5, 4500 ) );
+}
+
+int runUnityTests( void )
+{
+  UNITY_BEGIN();
+  RUN_TEST( test_learn_needs_variation );
+  RUN_TEST( test_learn_negative_drift );
+  RUN_TEST( test_learn_clamps_coefficient );
+  RUN_TEST( test_learn_skips_unusable_pairs );
+  RUN_TEST( test_learn_forgets_old_pairs );
+  RUN_TEST( test_compensate_to_reference );
+  return UNITY_END();
+}
+
+int main( void )
+{
+  return runUnityTests();
+}
@@ -0,0 +1,192 @@
+//
+// host benchmark of the api dispatch (src/apiRoute.cpp) against the regex routes before
+// checks the lookup and the parameter parsing, then prints ns per request
+//
+// usage: g++ -O2 -std=c++14 -Iinclude tools/bench-dispatch.cpp src/apiRoute.cpp -o /tmp/bench-dispatch
+//        /tmp/bench-dispatch [loops]
+//
+// the regex side does what the webserver did with ASYNCWEBSERVER_REGEX: every
+// handler builds its std::regex in canHandle() and searches the url, first match wins
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <regex>
+#include <string>
+#include "apiRoute.hpp"
+
+using measure_h2o::api_arg_t;
+using measure_h2o::api_route_t;
+using measure_h2o::ApiDispatch;
+using measure_h2o::ApiParam;
+
+static volatile size_t sink{ 0 };
+
+static void handler( AsyncWebServerRequest *, const api_arg_t &_arg )
+{
+  sink += static_cast< size_t >( _arg.number );
+}
+
+//
+// same paths and parameters as APIWebServer::apiRoutes
+//
+static const api_route_t routes[]{
+    { "status", nullptr, ApiParam::NONE, handler },
+    { "today", nullptr, ApiParam::NONE, handler },
+    { "since", nullptr, ApiParam::NONE, handler },
+    { "data", "from", ApiParam::TEXT, handler },
+    { "interval", nullptr, ApiParam::NONE, handler },
+    { "fsstat", nullptr, ApiParam::NONE, handler },
+    { "heap", nullptr, ApiParam::NONE, handler },
+    { "anomalies", nullptr, ApiParam::NONE, handler },
+    { "cycles", nullptr, ApiParam::NONE, handler },
+    { "led", nullptr, ApiParam::NONE, handler },
+    { "flash", nullptr, ApiParam::NONE, handler },
+    { "set-timezone", "timezone", ApiParam::TEXT, handler },
+    { "set-timezone", "timezone-offset", ApiParam::NUMBER, handler },
+    { "set-loglevel", "level", ApiParam::NUMBER, handler },
+    { "set-interval", "interval", ApiParam::NUMBER, handler },
+    { "set-led", "brightness", ApiParam::NUMBER, handler },
+    { "set-upload", "url", ApiParam::TEXT, handler },
+    { "set-fscheck", nullptr, ApiParam::NONE, handler },
+    { "set-calibpoint", "mbar", ApiParam::NUMBER, handler },
+    { "set-calibclear", nullptr, ApiParam::NONE, handler },
+    { "set-autozero", "enable", ApiParam::NUMBER, handler },
+    { "set-anomalyack", nullptr, ApiParam::NONE, handler } };
+static const size_t ROUTES = sizeof( routes ) / sizeof( api_route_t );
+
+//
+// the handler patterns of the webserver before the route table
+//
+static const char *const patterns[]{ "^/$",
+                                     "^/index\\.html$",
+                                     "^/metrics$",
+                                     "^\\/api\\/v1\\/set-(.*)\?(.*)$",
+                                     "^\\/api\\/v1\\/(.*)$",
+                                     "^\\/.*$" };
+
+//
+// one request: path and max one parameter
+//
+struct request_t
+{
+  const char *url;
+  const char *name;
+  const char *value;
+};
+
+static const char *lookup( void *_ctx, const char *_name )
+{
+  const request_t *req = static_cast< const request_t * >( _ctx );
+  return req->name && strcmp( req->name, _name ) == 0 ? req->value : nullptr;
+}
+
+static const api_route_t *dispatch( const request_t &_req, api_arg_t &_arg, const char *&_missing )
+{
+  static const char prefix[]{ "/api/v1/" };
+  if ( strncmp( _req.url, prefix, sizeof( prefix ) - 1 ) != 0 )
+    return nullptr;
+  return ApiDispatch::match( routes, ROUTES, _req.url + sizeof( prefix ) - 1, lookup, const_cast< request_t * >( &_req ), _arg,
+                             _missing );
+}
+
+static size_t regexDispatch( const request_t &_req )
+{
+  std::string url( _req.url );
+  for ( size_t idx = 0; idx < sizeof( patterns ) / sizeof( patterns[ 0 ] ); ++idx )
+  {
+    std::regex pattern( patterns[ idx ] );
+    std::smatch matches;
+    if ( std::regex_search( url, matches, pattern ) )
+      return idx;
+  }
+  return 0;
+}
+
+template < typename F >
+static double nsPerCall( F _fn, uint32_t _loops )
+{
+  auto start = std::chrono::steady_clock::now();
+  for ( uint32_t i = 0; i < _loops; ++i )
+    sink += _fn( i );
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration< double, std::nano >( end - start ).count() / _loops;
+}
+
+static int check()
+{
+  struct case_t
+  {
+    request_t req;
+    int route;            // index in routes, -1 == none
+    int32_t number;       // parsed value
+    const char *missing;  // expected missing parameter
+  };
+  static const case_t cases[]{
+      { { "/api/v1/status", nullptr, nullptr }, 0, 0, nullptr },
+      { { "/api/v1/set-anomalyack", nullptr, nullptr }, 21, 0, nullptr },
+      { { "/api/v1/set-interval", "interval", "60" }, 14, 60, nullptr },
+      { { "/api/v1/set-timezone", "timezone-offset", "-3600" }, 12, -3600, nullptr },
+      { { "/api/v1/set-timezone", "timezone", "CET-1CEST" }, 11, 0, nullptr },
+      { { "/api/v1/set-interval", "interval", "abc" }, -1, 0, "interval" },
+      { { "/api/v1/set-interval", "interval", "60s" }, -1, 0, "interval" },
+      { { "/api/v1/set-interval", "interval", "" }, -1, 0, "interval" },
+      { { "/api/v1/set-interval", "interval", "99999999999" }, -1, 0, "interval" },
+      { { "/api/v1/set-interval", nullptr, nullptr }, -1, 0, "interval" },
+      { { "/api/v1/set-timezone", nullptr, nullptr }, -1, 0, "timezone-offset" },
+      { { "/api/v1/unknown", nullptr, nullptr }, -1, 0, nullptr },
+      { { "/api/v1/statusx", nullptr, nullptr }, -1, 0, nullptr },
+      { { "/api/v2/status", nullptr, nullptr }, -1, 0, nullptr } };
+  int errors{ 0 };
+  for ( const case_t &c : cases )
+  {
+    api_arg_t arg{};
+    const char *missing{ nullptr };
+    const api_route_t *route = dispatch( c.req, arg, missing );
+    int idx = route ? static_cast< int >( route - routes ) : -1;
+    bool ok = idx == c.route && ( !route || arg.number == c.number ) &&
+              ( c.missing ? missing && strcmp( missing, c.missing ) == 0 : !missing );
+    if ( route && route->type == ApiParam::TEXT )
+      ok = ok && arg.text && strcmp( arg.text, c.req.value ) == 0;
+    if ( !ok )
+    {
+      printf( "check failed: <%s> %s=%s -> route %d number %d missing %s\n", c.req.url, c.req.name ? c.req.name : "",
+              c.req.value ? c.req.value : "", idx, arg.number, missing ? missing : "-" );
+      ++errors;
+    }
+  }
+  printf( "check: <%d> errors in <%zu> requests\n", errors, sizeof( cases ) / sizeof( cases[ 0 ] ) );
+  return errors;
+}
+
+static void report( const char *_name, const request_t &_req, uint32_t _loops )
+{
+  auto table = [ & ]( uint32_t )
+  {
+    api_arg_t arg;
+    const char *missing;
+    const api_route_t *route = dispatch( _req, arg, missing );
+    if ( route )
+      route->handler( nullptr, arg );
+    return reinterpret_cast< size_t >( route );
+  };
+  auto regex = [ & ]( uint32_t ) { return regexDispatch( _req ); };
+  // regex is slow, less loops
+  double fast = nsPerCall( table, _loops );
+  double slow = nsPerCall( regex, _loops / 100 + 1 );
+  printf( "%-22s table %8.1f ns  regex %10.1f ns  x%.0f\n", _name, fast, slow, slow / fast );
+}
+
+int main( int argc, char **argv )
+{
+  uint32_t loops = argc > 1 ? static_cast< uint32_t >( atol( argv[ 1 ] ) ) : 2000000U;
+  int errors = check();
+
+  report( "first (status)", request_t{ "/api/v1/status", nullptr, nullptr }, loops );
+  report( "last (set-anomalyack)", request_t{ "/api/v1/set-anomalyack", nullptr, nullptr }, loops );
+  report( "number (set-interval)", request_t{ "/api/v1/set-interval", "interval", "600" }, loops );
+  report( "alternative (tz offs)", request_t{ "/api/v1/set-timezone", "timezone-offset", "3600" }, loops );
+  report( "not found", request_t{ "/api/v1/nothing", nullptr, nullptr }, loops );
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+//
+// host benchmark of the integer formatters (src/numFormat.cpp) against snprintf
+// checks the same output on a sweep of values, then prints ns per call
+//
+// usage: g++ -O2 -std=c++14 -Iinclude tools/bench-numformat.cpp src/numFormat.cpp -o /tmp/bench-numformat
+//        /tmp/bench-numformat [loops]
+//
+// on the host both are fast, the ratio counts; on the esp32-c3 (no FPU) float
+// printf is the expensive part
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include "numFormat.hpp"
+
+using measure_h2o::NumFormat;
+
+static volatile size_t sink{ 0 };
+
+template < typename F >
+static double nsPerCall( F _fn, uint32_t _loops )
+{
+  auto start = std::chrono::steady_clock::now();
+  for ( uint32_t i = 0; i < _loops; ++i )
+    sink += _fn( i );
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration< double, std::nano >( end - start ).count() / _loops;
+}
+
+static void report( const char *_name, double _fast, double _printf )
+{
+  printf( "%-22s numformat %7.1f ns  snprintf %7.1f ns  x%.1f\n", _name, _fast, _printf, _printf / _fast );
+}
+
+static int check()
+{
+  char a[ 32 ];
+  char b[ 32 ];
+  int errors{ 0 };
+  for ( uint32_t v = 0; v < 200000; v += 7 )
+  {
+    // millivolts in the day file
+    NumFormat::u32( a, sizeof( a ), v, 6 );
+    snprintf( b, sizeof( b ), "%06u", v );
+    errors += strcmp( a, b ) != 0;
+    // bar with 2 decimals, from the integer scale (no float rounding ties)
+    NumFormat::scaled( a, sizeof( a ), static_cast< int64_t >( v ) - 100000, 2 );
+    int64_t s = static_cast< int64_t >( v ) - 100000;
+    snprintf( b, sizeof( b ), "%s%lld.%02lld", s < 0 ? "-" : "", llabs( s ) / 100, llabs( s ) % 100 );
+    errors += strcmp( a, b ) != 0;
+    NumFormat::i32( a, sizeof( a ), static_cast< int32_t >( v ) - 100000 );
+    snprintf( b, sizeof( b ), "%d", static_cast< int >( v ) - 100000 );
+    errors += strcmp( a, b ) != 0;
+  }
+  // steps of one day minus one secound from 1970 to 2100, every time of the day comes once
+  for ( int64_t t = 0; t < 4102444800LL; t += 86399 )
+  {
+    time_t stamp = static_cast< time_t >( t );
+    struct tm ti;
+    gmtime_r( &stamp, &ti );
+    NumFormat::isoDateTime( a, sizeof( a ), stamp );
+    strftime( b, sizeof( b ), "%Y-%m-%dT%H:%M:%S", &ti );
+    errors += strcmp( a, b ) != 0;
+  }
+  // float: different only at ties, report them but don't fail
+  uint32_t ties{ 0 };
+  for ( uint32_t v = 0; v < 60000; ++v )
+  {
+    float bar = v / 10000.0F;
+    NumFormat::fixed( a, sizeof( a ), bar, 2 );
+    snprintf( b, sizeof( b ), "%.2f", bar );
+    ties += strcmp( a, b ) != 0;
+  }
+  printf( "check: <%d> errors, <%u> float rounding differences of 60000\n", errors, ties );
+  return errors;
+}
+
+int main( int argc, char **argv )
+{
+  uint32_t loops = argc > 1 ? static_cast< uint32_t >( atol( argv[ 1 ] ) ) : 2000000U;
+  char buffer[ 32 ];
+  int errors = check();
+
+  auto u32Fast = [ & ]( uint32_t i ) { return NumFormat::u32( buffer, sizeof( buffer ), i, 6 ); };
+  auto u32Printf = [ & ]( uint32_t i ) { return static_cast< size_t >( snprintf( buffer, sizeof( buffer ), "%06u", i ) ); };
+  report( "u32 %06u", nsPerCall( u32Fast, loops ), nsPerCall( u32Printf, loops ) );
+
+  auto i32Fast = [ & ]( uint32_t i ) { return NumFormat::i32( buffer, sizeof( buffer ), -static_cast< int32_t >( i ) ); };
+  auto i32Printf = [ & ]( uint32_t i )
+  {
+    return static_cast< size_t >( snprintf( buffer, sizeof( buffer ), "%d", -static_cast< int >( i ) ) );
+  };
+  report( "i32 %d", nsPerCall( i32Fast, loops ), nsPerCall( i32Printf, loops ) );
+
+  auto fixedFast = [ & ]( uint32_t i ) { return NumFormat::fixed( buffer, sizeof( buffer ), i / 1000.0F, 2 ); };
+  auto fixedPrintf = [ & ]( uint32_t i )
+  {
+    return static_cast< size_t >( snprintf( buffer, sizeof( buffer ), "%.2f", i / 1000.0F ) );
+  };
+  report( "fixed %.2f", nsPerCall( fixedFast, loops ), nsPerCall( fixedPrintf, loops ) );
+
+  auto isoFast = [ & ]( uint32_t i )
+  {
+    return NumFormat::isoDateTime( buffer, sizeof( buffer ), static_cast< time_t >( 1700000000U + i * 37U ) );
+  };
+  auto isoPrintf = [ & ]( uint32_t i )
+  {
+    time_t stamp = static_cast< time_t >( 1700000000U + i * 37U );
+    struct tm ti;
+    gmtime_r( &stamp, &ti );
+    int len = snprintf( buffer, sizeof( buffer ), "%04d-%02d-%02dT%02d:%02d:%02d", ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday,
+                        ti.tm_hour, ti.tm_min, ti.tm_sec );
+    return static_cast< size_t >( len );
+  };
+  report( "iso date (epoch)", nsPerCall( isoFast, loops ), nsPerCall( isoPrintf, loops ) );
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#
+# load generator for the http api of the device
+# mixed traffic with n parallel clients, reports latency (p50/p99),
+# throughput, errors and the heap of the device (from /api/v1/status)
+#
+# usage: ./loadtest.py <host> [--clients 4] [--duration 30] [--with-set]
+#
+# set-* calls restart the device (except set-fscheck), so only
+# set-fscheck is used and only with --with-set
+#
+import argparse
+import http.client
+import json
+import random
+import threading
+import time
+
+# (name, path, weight)
+TRAFFIC = [
+    ("metrics", "/metrics", 3),
+    ("today", "/api/v1/today", 2),
+    ("index", "/", 2),
+    ("css", "/presure.css", 1),
+    ("status", "/api/v1/status", 1),
+    ("since", "/api/v1/since", 1),
+]
+SET_TRAFFIC = [("set-fscheck", "/api/v1/set-fscheck", 1)]
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latency = {}
+        self.codes = {}
+        self.errors = {}
+        self.bytes = 0
+
+    def add(self, name, seconds, code, size):
+        with self.lock:
+            self.latency.setdefault(name, []).append(seconds)
+            self.codes.setdefault(name, {}).setdefault(code, 0)
+            self.codes[name][code] += 1
+            self.bytes += size
+
+    def error(self, name, text):
+        with self.lock:
+            self.errors.setdefault(name, {}).setdefault(text, 0)
+            self.errors[name][text] += 1
+
+
+def percentile(values, pct):
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(pct / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def request(host, port, path, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request("GET", path, headers={"Accept-Encoding": "gzip"})
+        resp = conn.getresponse()
+        body = resp.read()
+        return resp.status, body
+    finally:
+        conn.close()
+
+
+def device_heap(host, port, timeout):
+    try:
+        code, body = request(host, port, "/api/v1/status", timeout)
+        if code != 200:
+            return None
+        return json.loads(body)["heap"]
+    except (OSError, ValueError, KeyError, http.client.HTTPException):
+        return None
+
+
+def worker(args, traffic, stats, stop_at):
+    names = [t for t in traffic for _ in range(t[2])]
+    while time.monotonic() < stop_at:
+        name, path, _ = random.choice(names)
+        start = time.monotonic()
+        try:
+            code, body = request(args.host, args.port, path, args.timeout)
+            stats.add(name, time.monotonic() - start, code, len(body))
+        except (OSError, http.client.HTTPException) as err:
+            stats.error(name, type(err).__name__)
+        if args.pause:
+            time.sleep(args.pause)
+
+
+def heap_sampler(args, samples, stop_at):
+    while time.monotonic() < stop_at:
+        heap = device_heap(args.host, args.port, args.timeout)
+        if heap:
+            samples.append(heap)
+        time.sleep(args.heap_interval)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="http load test for the pressure device")
+    parser.add_argument("host", help="hostname or ip of the device")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=4, help="parallel clients")
+    parser.add_argument("--duration", type=float, default=30.0, help="secounds")
+    parser.add_argument("--timeout", type=float, default=10.0, help="request timeout secounds")
+    parser.add_argument("--pause", type=float, default=0.0, help="pause per client between requests")
+    parser.add_argument("--heap-interval", type=float, default=2.0, help="secounds between heap samples")
+    parser.add_argument("--with-set", action="store_true", help="add set-fscheck calls")
+    parser.add_argument("--seed", type=int, default=1, help="random seed, same seed same traffic mix")
+    args = parser.parse_args()
+    random.seed(args.seed)
+
+    traffic = TRAFFIC + (SET_TRAFFIC if args.with_set else [])
+    heap_before = device_heap(args.host, args.port, args.timeout)
+    stats = Stats()
+    samples = []
+    started = time.monotonic()
+    stop_at = started + args.duration
+    threads = [threading.Thread(target=worker, args=(args, traffic, stats, stop_at)) for _ in range(args.clients)]
+    threads.append(threading.Thread(target=heap_sampler, args=(args, samples, stop_at)))
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.monotonic() - started
+    heap_after = device_heap(args.host, args.port, args.timeout)
+
+    total = sum(len(v) for v in stats.latency.values())
+    print(f"{args.clients} clients, {elapsed:.1f} s, {total} requests, {total / elapsed:.1f} req/s, {stats.bytes / elapsed / 1024:.1f} KB/s")
+    print(f"{'endpoint':<12} {'count':>6} {'p50 ms':>8} {'p99 ms':>8} {'max ms':>8}  codes / errors")
+    for name, _, _ in traffic:
+        values = stats.latency.get(name, [])
+        codes = " ".join(f"{c}:{n}" for c, n in sorted(stats.codes.get(name, {}).items()))
+        errors = " ".join(f"{e}:{n}" for e, n in sorted(stats.errors.get(name, {}).items()))
+        if values:
+            print(f"{name:<12} {len(values):>6} {percentile(values, 50) * 1000:>8.0f} {percentile(values, 99) * 1000:>8.0f} "
+                  f"{max(values) * 1000:>8.0f}  {codes} {errors}")
+        else:
+            print(f"{name:<12} {0:>6} {'-':>8} {'-':>8} {'-':>8}  {errors}")
+    if samples:
+        print(f"heap free while test: min {min(s['free'] for s in samples)}, min block {min(s['maxBlock'] for s in samples)}")
+    if heap_before and heap_after:
+        print(f"heap min since boot: before {heap_before['min']}, after {heap_after['min']}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# compile the web files into the firmware: include/wwwAssets.hpp
+#
+#  - data/www/*   : plain and gzip bytes, content hash (ETag)
+#  - templates/*  : html templates, split into literal and %VAR% segments
+#
+# runs as platformio pre script (extra_scripts) before every build,
+# or by hand from the project directory: ./tools/makeWww.py
+#
+import gzip
+import hashlib
+import io
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 (platformio/scons)
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WWW_DIR = os.path.join(PROJECT_DIR, "data", "www")
+TEMPLATE_DIR = os.path.join(PROJECT_DIR, "templates")
+DEST_FILE = os.path.join(PROJECT_DIR, "include", "wwwAssets.hpp")
+DEVICE_PATH = "/www/"
+VAR_PATTERN = re.compile(r"%([A-Z_]+)%")
+RAW_DELIMITER = "rawliteral"
+
+
+def c_name(prefix, name):
+    return prefix + re.sub(r"[^A-Z0-9]", "_", name.upper())
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("      " + ", ".join(f"0x{b:02x}" for b in data[i : i + 16]))
+    return ",\n".join(lines)
+
+
+def gzip_bytes(content):
+    # mtime 0 and no filename, same input -> same output
+    raw = io.BytesIO()
+    with gzip.GzipFile(filename="", mode="wb", fileobj=raw, compresslevel=9, mtime=0) as gz:
+        gz.write(content)
+    return raw.getvalue()
+
+
+def list_files(folder):
+    return [n for n in sorted(os.listdir(folder)) if os.path.isfile(os.path.join(folder, n))]
+
+
+def make_assets(out):
+    table = []
+    for name in list_files(WWW_DIR):
+        src = os.path.join(WWW_DIR, name)
+        if name.endswith(".gz"):
+            # old gzip files from the filesystem, not longer needed
+            os.remove(src)
+            continue
+        with open(src, "rb") as fh:
+            content = fh.read()
+        gz = gzip_bytes(content)
+        etag = hashlib.sha1(content).hexdigest()[:16]
+        ident = c_name("WWW_", name)
+        out.append(f"  const uint8_t {ident}[] PROGMEM = {{\n{c_bytes(content)} }};")
+        out.append(f"  const uint8_t {ident}_GZ[] PROGMEM = {{\n{c_bytes(gz)} }};")
+        table.append(f'{{ "{DEVICE_PATH}{name}", "{etag}", {ident}, sizeof( {ident} ), {ident}_GZ, sizeof( {ident}_GZ ) }}')
+        print(f"www: {name}: {len(content)} -> {len(gz)} bytes, etag {etag}")
+    if not table:
+        raise SystemExit("www: no files in data/www!")
+    out.append("  constexpr www_asset_t WWW_ASSETS[]{")
+    out.append(",\n".join("      " + t for t in table) + " };")
+
+
+def make_templates(out):
+    table = []
+    for name in list_files(TEMPLATE_DIR):
+        with open(os.path.join(TEMPLATE_DIR, name), "r") as fh:
+            text = fh.read()
+        ident = c_name("TMPL_", name)
+        segments = []
+        pos = 0
+        for match in VAR_PATTERN.finditer(text):
+            segments.append(("text", text[pos : match.start()]))
+            segments.append(("var", match.group(1)))
+            pos = match.end()
+        segments.append(("text", text[pos:]))
+        entries = []
+        for kind, value in segments:
+            if kind == "var":
+                entries.append(f"{{ nullptr, 0, TmplVar::{value} }}")
+            elif value:
+                if f"){RAW_DELIMITER}" in value:
+                    raise SystemExit(f"www: template {name} contains the raw string delimiter!")
+                lit = f"{ident}_{len(entries)}"
+                out.append(f'  const char {lit}[] PROGMEM = R"{RAW_DELIMITER}({value}){RAW_DELIMITER}";')
+                entries.append(f"{{ {lit}, sizeof( {lit} ) - 1, TmplVar::NONE }}")
+        out.append(f"  constexpr www_segment_t {ident}[]{{")
+        out.append(",\n".join("      " + e for e in entries) + " };")
+        table.append(f'{{ "{DEVICE_PATH}{name}", {ident}, sizeof( {ident} ) / sizeof( www_segment_t ) }}')
+        print(f"www: template {name}: {len(entries)} segments")
+    if not table:
+        raise SystemExit("www: no files in templates!")
+    out.append("  constexpr www_template_t WWW_TEMPLATES[]{")
+    out.append(",\n".join("      " + t for t in table) + " };")
+
+
+def write_header():
+    out = [
+        "#pragma once",
+        "//",
+        "// generated by tools/makeWww.py, do not edit",
+        "//",
+        "#include <Arduino.h>",
+        '#include "appStructs.hpp"',
+        "",
+        "namespace measure_h2o",
+        "{",
+    ]
+    make_assets(out)
+    make_templates(out)
+    out.append("}  // namespace measure_h2o")
+    out.append("")
+    text = "\n".join(out)
+    # rewrite only if changed, avoid rebuilds
+    if os.path.exists(DEST_FILE):
+        with open(DEST_FILE, "r") as fh:
+            if fh.read() == text:
+                return
+    with open(DEST_FILE, "w") as fh:
+        fh.write(text)
+    print(f"www: {DEST_FILE} written")
+
+
+write_header()
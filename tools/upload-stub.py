@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+#
+# minimal collector stub for the push uploader
+# prints every received line protocol batch and answers 204
+#
+# usage: ./upload-stub.py [port] [fail-every-n]
+#
+import sys
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+PORT = int(sys.argv[1]) if len(sys.argv) > 1 else 8086
+FAIL_EVERY = int(sys.argv[2]) if len(sys.argv) > 2 else 0
+requests = 0
+
+
+class Collector(BaseHTTPRequestHandler):
+    def do_POST(self):
+        global requests
+        requests += 1
+        length = int(self.headers.get("Content-Length", 0))
+        body = self.rfile.read(length).decode("utf-8", "replace")
+        lines = [line for line in body.split("\n") if line]
+        if FAIL_EVERY and requests % FAIL_EVERY == 0:
+            print(f"--- request {requests}: {len(lines)} lines, answer 503 (simulated outage)")
+            self.send_response(503)
+            self.end_headers()
+            return
+        print(f"--- request {requests} {self.path}: {len(lines)} lines")
+        for line in lines:
+            print(line)
+        self.send_response(204)
+        self.end_headers()
+
+    def log_message(self, format, *args):
+        pass
+
+
+print(f"collector stub on port {PORT}...")
+HTTPServer(("", PORT), Collector).serve_forever()